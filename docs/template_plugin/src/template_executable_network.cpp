@@ -79,6 +79,8 @@ void TemplatePlugin::ExecutableNetwork::InitExecutor() {
     // real hardware cores and NUMA nodes.
     auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg._streamsExecutorConfig);
     streamsExecutorConfig._name = "TemplateStreamsExecutor";
+    // Reference kernels of a request run on the threads of its stream only
+    _threadsPerStream = static_cast<std::size_t>(streamsExecutorConfig._threadsPerStream);
     // As Inference Engine CPU Streams Executor creates some additional therads
     // it is better to avoid threads recreateion as some OSs memory allocator can not manage such usage cases
     // and memory consumption can be larger than it is expected.
@@ -55,6 +55,7 @@ private:
     std::shared_ptr<ngraph::Function>           _function;
     std::map<std::string, std::size_t>          _inputIndex;
     std::map<std::string, std::size_t>          _outputIndex;
+    std::size_t                                 _threadsPerStream = 0;
 };
 // ! [executable_network:header]
 
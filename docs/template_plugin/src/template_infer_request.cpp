@@ -18,6 +18,7 @@
 #include <ie_parallel.hpp>
 #include <ie_memcpy.h>
 #include <precision_utils.h>
+#include <ngraph/runtime/parallel.hpp>
 
 #include "template/template_config.hpp"
 #include "template_infer_request.hpp"
@@ -213,6 +214,7 @@ void TemplateInferRequest::inferPreprocess() {
 void TemplateInferRequest::startPipeline() {
     OV_ITT_SCOPED_TASK(itt::domains::TemplatePlugin, _profilingTask[StartPipeline])
     auto start = Time::now();
+    ngraph::runtime::ParallelThreadsLimit threadsLimit(_executableNetwork->_threadsPerStream);
     _executable->call(_outputTensors, _inputTensors);
     _durations[StartPipeline] = Time::now() - start;
 }
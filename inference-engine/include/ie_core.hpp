@@ -73,6 +73,8 @@ public:
      *  * if bin file with the same name was not found, will load IR without weights.
      * For ONNX format (*.onnx or *.prototxt):
      *  * binPath parameter is not used.
+     * @note IR weights are mapped into memory, so the bin file must not be truncated or modified while the
+     * network is used. Reading weights from a truncated file crashes the process (SIGBUS on Linux).
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath = {}) const;
@@ -85,6 +87,8 @@ public:
      * `InferenceEngine::Core::ReadNetwork(const std::string& model, const Blob::CPtr& weights) const`
      * function overload which takes a filesystem path to the model.
      * For ONNX case the second parameter should contain empty blob.
+     * @note For IR format constants of the network refer to the weights blob memory instead of copying it,
+     * so the memory must not be modified or released while the network is used.
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const;
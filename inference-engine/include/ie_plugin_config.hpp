@@ -158,6 +158,13 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a bool value whether a device imports exported networks without compiling them again.
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT". Core caches compiled networks only for devices reporting true.
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
 }  // namespace Metrics
 
 /**
@@ -362,6 +369,27 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The key enables parallel execution of independent network branches inside a CPU stream
+ *
+ * Ready layers are dispatched to the threads of the stream as soon as their inputs are computed, which
+ * reduces latency of wide networks (e.g. Inception-like or multi-head) executed with a few streams.
+ * The option is applied on network loading. Expected values: YES/NO, default is NO.
+ * Networks with memory layers are always executed sequentially.
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief The key places intermediate data of a CPU network into memory shared by all networks of the process
+ *
+ * The memory is leased from a process-wide pool for the time of each inference, so networks which are not
+ * executed at the same moment reuse the same memory. It reduces the memory footprint of processes hosting many
+ * networks to about one set of intermediate buffers per concurrently executed stream.
+ * The option is applied on network loading. Expected values: YES/NO, default is NO.
+ * Inputs, outputs and data of layers keeping direct pointers to their inputs are not shared.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_ACTIVATIONS);
+
 /**
 * @brief This key defines the directory which will be used to store any data cached by plugins.
 *
@@ -375,5 +403,26 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+* @brief This key defines the directory where InferenceEngine::Core caches compiled networks.
+*
+* It is a Core level setting and can be set only via Core::SetConfig without a device name.
+* When it is set, Core::LoadNetwork computes a hash of the network, the device and the configuration and
+* imports the network from the cache if there is a matching blob; otherwise the network is compiled and
+* exported to the cache. Only devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT) are cached.
+* The directory is created if it does not exist, but its parent directory must exist.
+* If this key is not specified or value is empty string, then caching is disabled.
+* ie.SetConfig({{CONFIG_KEY(NETWORK_CACHE_DIR), "cache/"}})
+*/
+DECLARE_CONFIG_KEY(NETWORK_CACHE_DIR);
+
+/**
+* @brief This key limits the total size in bytes of networks cached in NETWORK_CACHE_DIR.
+*
+* When the limit is exceeded, the least recently used networks are removed from the cache.
+* The default value is "0", which means the cache size is unlimited.
+*/
+DECLARE_CONFIG_KEY(NETWORK_CACHE_SIZE_LIMIT);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -34,5 +34,21 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, defines how a device is selected for the next inference request
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+
+/**
+ * @brief The first device in the priority order which has an idle request is used (default)
+ */
+DECLARE_MULTI_CONFIG_VALUE(DEVICE_PRIORITY);
+
+/**
+ * @brief The device which is expected to complete the request first is used. The expectation is based on
+ * the measured inference time of the device and the number of its requests in flight.
+ */
+DECLARE_MULTI_CONFIG_VALUE(LEAST_OUTSTANDING);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
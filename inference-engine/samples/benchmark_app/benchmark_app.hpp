@@ -103,6 +103,16 @@ static const char shape_message[] = "Optional. Set shape for input. For example,
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
+// @brief message for open-loop rate option
+static const char rate_message[] = "Optional. Enable open-loop load generation in the async mode: start infer requests at the given "
+                                   "average rate (requests per second) independently of completion of the previous ones. "
+                                   "Latency is measured from the scheduled start time, so it includes waiting for an idle infer request. "
+                                   "Default value is 0 that means closed-loop execution: every request is restarted as soon as it completes.";
+
+// @brief message for arrival schedule option
+static const char arrival_message[] = "Optional. Arrival schedule of the open-loop mode: \"constant\" (fixed interval between requests, default) "
+                                      "or \"poisson\" (exponentially distributed intervals).";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -190,6 +200,12 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for quantization bits (default 16)
 DEFINE_int32(qb, 16, gna_qb_message);
 
+/// @brief Target rate of the open-loop mode (default 0 that means closed loop)
+DEFINE_double(rate, 0.0, rate_message);
+
+/// @brief Arrival schedule of the open-loop mode
+DEFINE_string(arrival, "constant", arrival_message);
+
 /**
 * @brief This function show a help message
 */
@@ -213,6 +229,8 @@ static void showUsage() {
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
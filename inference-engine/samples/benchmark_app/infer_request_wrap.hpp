@@ -42,7 +42,12 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request, its latency is measured from the given time point (e.g. a scheduled arrival time)
+    void startAsync(const Time::time_point& startTime) {
+        _startTime = startTime;
         _request.StartAsync();
     }
 
@@ -4,9 +4,13 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <iomanip>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -67,6 +71,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("Incorrect rate. Please set -rate option to a non-negative value.");
+    }
+
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-rate option) is supported only for the async API.");
+    }
+
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival schedule. Please set -arrival option to `constant` or `poisson` value.");
+    }
+
     return true;
 }
 
@@ -103,6 +119,15 @@ T getMedianValue(const std::vector<T> &vec) {
            (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
 }
 
+/**
+* @brief Returns the nearest-rank percentile of values sorted in ascending order
+*/
+template <typename T>
+T getPercentileValue(const std::vector<T> &sortedVec, double percentile) {
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sortedVec.size()));
+    return sortedVec[std::min(std::max(rank, static_cast<size_t>(1)), sortedVec.size()) - 1];
+}
+
 /**
 * @brief The entry point of the benchmark application
 */
@@ -509,6 +534,10 @@ int main(int argc, char *argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        const bool openLoop = FLAGS_rate > 0;
+        if (openLoop) {
+            ss << ", open loop with " << FLAGS_arrival << " arrivals at " << FLAGS_rate << " requests per second";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
@@ -551,9 +580,23 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // In the open-loop mode requests are started by a schedule which does not depend on completion of the previous ones.
+        // If all requests are busy at the scheduled time, the request is started later, but its latency is still measured
+        // from the scheduled time, so queueing delays are not hidden.
+        std::mt19937 arrivalGenerator(std::random_device{}());
+        std::exponential_distribution<double> arrivalDistribution(openLoop ? FLAGS_rate : 1.0);
+        auto getArrivalInterval = [&] {
+            double seconds = FLAGS_arrival == "poisson" ? arrivalDistribution(arrivalGenerator) : 1.0 / FLAGS_rate;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+        auto arrivalTime = Time::now();
+
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -568,7 +611,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(arrivalTime);
+                    arrivalTime += getArrivalInterval();
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -590,7 +638,15 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        auto latencies = inferRequestsQueue.getLatencies();
+        std::sort(latencies.begin(), latencies.end());
+        double latency = getMedianValue<double>(latencies);
+        const std::vector<std::pair<std::string, double>> latencyPercentiles = {
+                {"p90", getPercentileValue(latencies, 90.0)},
+                {"p99", getPercentileValue(latencies, 99.0)},
+                {"p99.9", getPercentileValue(latencies, 99.9)},
+                {"max", latencies.back()},
+        };
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -606,6 +662,13 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                for (auto& percentile : latencyPercentiles) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {"latency " + percentile.first + " (ms)", double_to_string(percentile.second)},
+                                              });
+                }
+                statistics->addLatencyHistogram(latencies);
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -655,8 +718,13 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            for (auto& percentile : latencyPercentiles) {
+                std::cout << "    " << std::left << std::setw(8) << percentile.first + ":"
+                          << double_to_string(percentile.second) << " ms" << std::endl;
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
@@ -7,6 +7,7 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
 
 #include "statistics_report.hpp"
 
@@ -17,6 +18,38 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addLatencyHistogram(const std::vector<double>& latencies) {
+    _latencyHistogram.clear();
+    if (latencies.empty())
+        return;
+
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+
+    // buckets bounds follow 1-2-5 series, so they are readable and cover several orders of magnitude
+    const double minLatency = std::max(sorted.front(), 0.001);
+    double decade = std::pow(10.0, std::floor(std::log10(minLatency)));
+    std::vector<double> bounds;
+    while (bounds.empty() || bounds.back() < sorted.back()) {
+        for (double mantissa : {1.0, 2.0, 5.0}) {
+            bounds.push_back(decade * mantissa);
+        }
+        decade *= 10.0;
+    }
+
+    auto begin = sorted.begin();
+    for (double bound : bounds) {
+        auto end = std::upper_bound(begin, sorted.end(), bound);
+        _latencyHistogram.emplace_back(bound, static_cast<size_t>(end - begin));
+        begin = end;
+    }
+    // skip empty buckets below the smallest latency and above the largest one
+    while (!_latencyHistogram.empty() && _latencyHistogram.front().second == 0)
+        _latencyHistogram.erase(_latencyHistogram.begin());
+    while (!_latencyHistogram.empty() && _latencyHistogram.back().second == 0)
+        _latencyHistogram.pop_back();
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
@@ -50,6 +83,26 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (!_latencyHistogram.empty()) {
+        dumper << "Latency histogram";
+        dumper.endLine();
+
+        size_t total = 0;
+        for (auto& bucket : _latencyHistogram)
+            total += bucket.second;
+
+        dumper << "latency up to (ms)" << "count" << "cumulative (%)";
+        dumper.endLine();
+        size_t cumulative = 0;
+        for (auto& bucket : _latencyHistogram) {
+            cumulative += bucket.second;
+            dumper << double_to_string(bucket.first) << std::to_string(bucket.second)
+                   << double_to_string(100.0 * cumulative / total);
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -53,6 +53,9 @@ public:
 
     void addParameters(const Category &category, const Parameters& parameters);
 
+    /// @brief Builds a histogram of latencies (in milliseconds) which is dumped with the execution results
+    void addLatencyHistogram(const std::vector<double>& latencies);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
@@ -67,6 +70,9 @@ private:
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // latency histogram: upper bound of a bucket in milliseconds and number of latencies in it
+    std::vector<std::pair<double, size_t>> _latencyHistogram;
+
     // csv separator
     std::string _separator;
 };
@@ -28,6 +28,7 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
             uint32_t nireq = 1;
             return nireq;
         }},
+        {METRIC_KEY(IMPORT_EXPORT_SUPPORT), []() {return true;}},
         {METRIC_KEY(FULL_DEVICE_NAME), [&options, this]() {
             auto availableDevices = GetAvailableDevices().as<std::vector<std::string>>();
 
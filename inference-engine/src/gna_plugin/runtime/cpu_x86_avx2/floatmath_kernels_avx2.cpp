@@ -0,0 +1,22 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime/floatmath_kernels_impl.hpp"
+
+#if !defined(__AVX2__)
+#error The file has to be compiled with AVX2 support
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx2 {
+
+const FloatMathKernels& GetFloatMathKernels() {
+    static const FloatMathKernels kernels = FloatMathKernelsImpl<VecAvx2>::Get();
+    return kernels;
+}
+
+}  // namespace avx2
+}  // namespace runtime
+}  // namespace GNAPluginNS
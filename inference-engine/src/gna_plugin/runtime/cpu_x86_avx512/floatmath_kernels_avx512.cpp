@@ -0,0 +1,22 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime/floatmath_kernels_impl.hpp"
+
+#if !defined(__AVX512F__)
+#error The file has to be compiled with AVX512F support
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace avx512 {
+
+const FloatMathKernels& GetFloatMathKernels() {
+    static const FloatMathKernels kernels = FloatMathKernelsImpl<VecAvx512>::Get();
+    return kernels;
+}
+
+}  // namespace avx512
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -1,13 +1,52 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, common cases are dispatched to vectorized kernels
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 
 #include "floatmath.h"
+#include "floatmath_kernels.hpp"
+
+namespace {
+
+using GNAPluginNS::runtime::GetFloatMathKernels;
+
+// Kernels work with transposed B, so rows of both matrices are contiguous
+const float* TransposeB(const float *B, MKL_INT ldb, MKL_INT K, MKL_INT N, MKL_INT &ldbt) {
+    ldbt = K;
+    if (N == 1 && ldb == 1) {
+        return B;
+    }
+    thread_local std::vector<float> transposed;
+    transposed.resize(static_cast<size_t>(N) * K);
+    for (MKL_INT k = 0; k < K; k++) {
+        for (MKL_INT j = 0; j < N; j++) {
+            transposed[static_cast<size_t>(j) * K + k] = B[static_cast<size_t>(k) * ldb + j];
+        }
+    }
+    return transposed.data();
+}
+
+void ScaleC(float *C, MKL_INT ldc, MKL_INT M, MKL_INT N, float beta) {
+    if (beta == 1.0f) {
+        return;
+    }
+    for (MKL_INT i = 0; i < M; i++) {
+        float *row = C + static_cast<size_t>(i) * ldc;
+        if (beta == 0.0f) {
+            std::fill(row, row + N, 0.0f);
+        } else {
+            std::transform(row, row + N, row, [beta](float c) { return beta * c; });
+        }
+    }
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +66,14 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
-            }
-        }
+        // alpha is not applied here, C is either accumulated or overwritten
+        ScaleC(C, ldc, M, N, beta == 1.0f ? 1.0f : 0.0f);
+        MKL_INT ldbt;
+        const float *Bt = TransposeB(B, ldb, K, N, ldbt);
+        GetFloatMathKernels().gemm_nt(A, lda, nullptr, M, Bt, ldbt, N, K, C, ldc);
+    } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans) && (alpha == 1.0f)) {
+        ScaleC(C, ldc, M, N, beta);
+        GetFloatMathKernels().gemm_nt(A, lda, nullptr, M, B, ldb, N, K, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -66,8 +104,6 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
                   const MKL_INT N, const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *X, const MKL_INT incX,
                   const float beta, float *Y, const MKL_INT incY) {
-    int i;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_ssbmv!\n");
         throw -1;
@@ -81,9 +117,7 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
         throw -1;
     }
     if ((alpha == 1.0) && (beta == 1.0) && (incX == 1) && (incY == 1)) {
-        for (i = 0; i < N; i++) {
-            Y[i] += A[i] * X[i];
-        }
+        GetFloatMathKernels().diagonal(A, X, Y, N);
     } else {
         fprintf(stderr, "Only alpha=1, beta=1, incX=1, incY=1, LDA=1 supported in cblas_ssbmv at this time!\n");
         throw -1;
@@ -105,16 +139,10 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
-            }
-        }
+        ScaleC(C, ldc, L, N, beta == 1.0f ? 1.0f : 0.0f);
+        MKL_INT ldbt;
+        const float *Bt = TransposeB(B, ldb, K, N, ldbt);
+        GetFloatMathKernels().gemm_nt(A, lda, OutputList, L, Bt, ldbt, N, K, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -153,19 +181,13 @@ void sgemv_split(const uint32_t N,
                  const float *X,
                  const float *B,
                  float *C) {
+    const auto& kernels = GetFloatMathKernels();
     uint32_t num_columns = K1 + K2;
     uint32_t num_rows = N;
-    uint32_t i, j;
 
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
+    for (uint32_t i = 0; i < num_rows; i++) {
+        const float *row = X + static_cast<size_t>(i) * num_columns;
+        C[i] = B[i] + kernels.dot(A1, row, K1) + kernels.dot(A2, row + K1, K2);
     }
 }
 
@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_kernels.hpp"
+#include "floatmath_kernels_impl.hpp"
+
+#include <ie_system_conf.h>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+const FloatMathKernels& GetFloatMathKernels() {
+    static const FloatMathKernels& kernels = []() -> const FloatMathKernels& {
+#ifdef HAVE_AVX512F
+        if (InferenceEngine::with_cpu_x86_avx512f()) {
+            return avx512::GetFloatMathKernels();
+        }
+#endif
+#ifdef HAVE_AVX2
+        if (InferenceEngine::with_cpu_x86_avx2()) {
+            return avx2::GetFloatMathKernels();
+        }
+#endif
+        return scalar::GetFloatMathKernels();
+    }();
+    return kernels;
+}
+
+namespace scalar {
+
+const FloatMathKernels& GetFloatMathKernels() {
+    static const FloatMathKernels kernels = FloatMathKernelsImpl<VecScalar>::Get();
+    return kernels;
+}
+
+}  // namespace scalar
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
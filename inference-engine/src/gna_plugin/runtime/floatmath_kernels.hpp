@@ -0,0 +1,63 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Kernels of the floating point runtime (GNA_SW_FP32 mode)
+ * Each instruction set has its own table, the best one supported by a host is selected in run time.
+ * Vector tables fuse multiply-add while the scalar one rounds the product, so results of the tables
+ * may differ in the last bits.
+ */
+struct FloatMathKernels {
+    /**
+     * @brief C[m][j] += A[rows[m]][:] . Bt[j][:] for m < M, j < N, where rows are K elements long
+     * rows == nullptr stands for rows[m] == m
+     */
+    void (*gemm_nt)(const float *A, size_t lda, const uint32_t *rows, size_t M,
+                    const float *Bt, size_t ldbt, size_t N, size_t K,
+                    float *C, size_t ldc);
+    /** @brief Returns a . b */
+    float (*dot)(const float *a, const float *b, size_t n);
+    /** @brief y[i] += a[i] * x[i] */
+    void (*diagonal)(const float *a, const float *x, float *y, size_t n);
+    /** @brief out[i] = tanh(in[i]), absolute error is below 5e-7 */
+    void (*tanh)(const float *in, float *out, size_t n);
+    /** @brief out[i] = 0.5 * (1 + tanh(0.5 * in[i])) */
+    void (*sigmoid)(const float *in, float *out, size_t n);
+    /** @brief out[i] = in[i] < 0 ? in[i] * negative_slope : in[i] */
+    void (*leaky_relu)(const float *in, float *out, size_t n, float negative_slope);
+    /** @brief out[i] = min(max(in[i], low), high), NaN values are kept */
+    void (*clamp)(const float *in, float *out, size_t n, float low, float high);
+    /** @brief out[i] = |in[i]| */
+    void (*abs)(const float *in, float *out, size_t n);
+    /** @brief out[i] = in[i] == 0 ? 0 : (in[i] > 0 ? 1 : -1) */
+    void (*sign)(const float *in, float *out, size_t n);
+};
+
+/**
+ * @brief Returns kernels for the best instruction set supported by the host CPU
+ */
+const FloatMathKernels& GetFloatMathKernels();
+
+namespace scalar {
+const FloatMathKernels& GetFloatMathKernels();
+}  // namespace scalar
+
+namespace avx2 {
+const FloatMathKernels& GetFloatMathKernels();
+}  // namespace avx2
+
+namespace avx512 {
+const FloatMathKernels& GetFloatMathKernels();
+}  // namespace avx512
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,299 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// floatmath_kernels_impl.hpp : kernels of the floating point runtime written over a vector abstraction.
+// The file is included into translation units compiled for different instruction sets, so everything
+// is placed into an anonymous namespace to avoid mixing of instantiations between them.
+//
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "floatmath_kernels.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace {
+
+// min / max return the second argument if any of arguments is NaN, as x86 vector instructions do
+struct VecScalar {
+    using type = float;
+    using mask = bool;
+    static constexpr size_t width = 1;
+
+    static type load(const float *p) { return *p; }
+    static void store(float *p, type v) { *p = v; }
+    static type set1(float v) { return v; }
+    static type add(type a, type b) { return a + b; }
+    static type mul(type a, type b) { return a * b; }
+    static type div(type a, type b) { return a / b; }
+    // fused as the vector fmadd, so a tail element is computed exactly as a vector lane
+    static type fmadd(type a, type b, type c) { return std::fma(a, b, c); }
+    static type min(type a, type b) { return a < b ? a : b; }
+    static type max(type a, type b) { return a > b ? a : b; }
+    static type abs(type a) { return std::fabs(a); }
+    static mask lt(type a, type b) { return a < b; }
+    static mask gt(type a, type b) { return a > b; }
+    static mask eq(type a, type b) { return a == b; }
+    static type select(mask m, type a, type b) { return m ? a : b; }
+    static float reduce(type v) { return v; }
+};
+
+#if defined(__AVX2__)
+struct VecAvx2 {
+    using type = __m256;
+    using mask = __m256;
+    static constexpr size_t width = 8;
+
+    static type load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, type v) { _mm256_storeu_ps(p, v); }
+    static type set1(float v) { return _mm256_set1_ps(v); }
+    static type add(type a, type b) { return _mm256_add_ps(a, b); }
+    static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+    static type div(type a, type b) { return _mm256_div_ps(a, b); }
+    static type fmadd(type a, type b, type c) { return _mm256_fmadd_ps(a, b, c); }
+    static type min(type a, type b) { return _mm256_min_ps(a, b); }
+    static type max(type a, type b) { return _mm256_max_ps(a, b); }
+    static type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static mask lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static mask gt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static mask eq(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static type select(mask m, type a, type b) { return _mm256_blendv_ps(b, a, m); }
+    static float reduce(type v) {
+        __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        sum = _mm_hadd_ps(sum, sum);
+        sum = _mm_hadd_ps(sum, sum);
+        return _mm_cvtss_f32(sum);
+    }
+};
+#endif  // __AVX2__
+
+#if defined(__AVX512F__)
+struct VecAvx512 {
+    using type = __m512;
+    using mask = __mmask16;
+    static constexpr size_t width = 16;
+
+    static type load(const float *p) { return _mm512_loadu_ps(p); }
+    static void store(float *p, type v) { _mm512_storeu_ps(p, v); }
+    static type set1(float v) { return _mm512_set1_ps(v); }
+    static type add(type a, type b) { return _mm512_add_ps(a, b); }
+    static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+    static type div(type a, type b) { return _mm512_div_ps(a, b); }
+    static type fmadd(type a, type b, type c) { return _mm512_fmadd_ps(a, b, c); }
+    static type min(type a, type b) { return _mm512_min_ps(a, b); }
+    static type max(type a, type b) { return _mm512_max_ps(a, b); }
+    static type abs(type a) { return _mm512_abs_ps(a); }
+    static mask lt(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static mask gt(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static mask eq(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static type select(mask m, type a, type b) { return _mm512_mask_blend_ps(m, b, a); }
+    static float reduce(type v) { return _mm512_reduce_add_ps(v); }
+};
+#endif  // __AVX512F__
+
+template <typename V>
+struct TanhOp {
+    // Rational approximation on the range where tanh(x) differs from +-1 in float
+    typename V::type operator()(typename V::type x) const {
+        const float clampValue = 7.90531110763549805f;
+        const float tinyValue = 0.0004f;
+
+        const auto clamped = V::min(V::set1(clampValue), V::max(V::set1(-clampValue), x));
+        const auto x2 = V::mul(clamped, clamped);
+
+        auto p = V::set1(-2.76076847742355e-16f);
+        p = V::fmadd(p, x2, V::set1(2.00018790482477e-13f));
+        p = V::fmadd(p, x2, V::set1(-8.60467152213735e-11f));
+        p = V::fmadd(p, x2, V::set1(5.12229709037114e-08f));
+        p = V::fmadd(p, x2, V::set1(1.48572235717979e-05f));
+        p = V::fmadd(p, x2, V::set1(6.37261928875436e-04f));
+        p = V::fmadd(p, x2, V::set1(4.89352455891786e-03f));
+        p = V::mul(p, clamped);
+
+        auto q = V::set1(1.19825839466702e-06f);
+        q = V::fmadd(q, x2, V::set1(1.18534705686654e-04f));
+        q = V::fmadd(q, x2, V::set1(2.26843463243900e-03f));
+        q = V::fmadd(q, x2, V::set1(4.89352518554385e-03f));
+
+        // tanh(x) == x for small values, approximation is less precise there
+        return V::select(V::lt(V::abs(x), V::set1(tinyValue)), x, V::div(p, q));
+    }
+};
+
+template <typename V>
+struct SigmoidOp {
+    typename V::type operator()(typename V::type x) const {
+        const auto half = V::set1(0.5f);
+        return V::fmadd(half, TanhOp<V>()(V::mul(half, x)), half);
+    }
+};
+
+template <typename V>
+struct LeakyReluOp {
+    explicit LeakyReluOp(float negativeSlope) : slope(V::set1(negativeSlope)) {}
+    typename V::type operator()(typename V::type x) const {
+        return V::select(V::lt(x, V::set1(0.0f)), V::mul(x, slope), x);
+    }
+    typename V::type slope;
+};
+
+template <typename V>
+struct ClampOp {
+    ClampOp(float low, float high) : low(V::set1(low)), high(V::set1(high)) {}
+    typename V::type operator()(typename V::type x) const {
+        return V::min(high, V::max(low, x));
+    }
+    typename V::type low;
+    typename V::type high;
+};
+
+template <typename V>
+struct AbsOp {
+    typename V::type operator()(typename V::type x) const {
+        return V::abs(x);
+    }
+};
+
+template <typename V>
+struct SignOp {
+    typename V::type operator()(typename V::type x) const {
+        const auto zero = V::set1(0.0f);
+        return V::select(V::eq(x, zero), zero, V::select(V::gt(x, zero), V::set1(1.0f), V::set1(-1.0f)));
+    }
+};
+
+template <typename V>
+struct FloatMathKernelsImpl {
+    template <template <typename> class Op, typename... Args>
+    static void ApplyUnary(const float *in, float *out, size_t n, Args... args) {
+        const Op<V> vectorOp(args...);
+        const Op<VecScalar> scalarOp(args...);
+        size_t i = 0;
+        for (; i + V::width <= n; i += V::width) {
+            V::store(out + i, vectorOp(V::load(in + i)));
+        }
+        for (; i < n; i++) {
+            out[i] = scalarOp(in[i]);
+        }
+    }
+
+    static float Dot(const float *a, const float *b, size_t n) {
+        auto s0 = V::set1(0.0f), s1 = V::set1(0.0f), s2 = V::set1(0.0f), s3 = V::set1(0.0f);
+        size_t k = 0;
+        for (; k + 4 * V::width <= n; k += 4 * V::width) {
+            s0 = V::fmadd(V::load(a + k), V::load(b + k), s0);
+            s1 = V::fmadd(V::load(a + k + V::width), V::load(b + k + V::width), s1);
+            s2 = V::fmadd(V::load(a + k + 2 * V::width), V::load(b + k + 2 * V::width), s2);
+            s3 = V::fmadd(V::load(a + k + 3 * V::width), V::load(b + k + 3 * V::width), s3);
+        }
+        for (; k + V::width <= n; k += V::width) {
+            s0 = V::fmadd(V::load(a + k), V::load(b + k), s0);
+        }
+        float sum = V::reduce(V::add(V::add(s0, s1), V::add(s2, s3)));
+        for (; k < n; k++) {
+            sum += a[k] * b[k];
+        }
+        return sum;
+    }
+
+    // Blocks of 4 rows of A share loads of Bt and keep 4 independent accumulators
+    static void GemmNT(const float *A, size_t lda, const uint32_t *rows, size_t M,
+                       const float *Bt, size_t ldbt, size_t N, size_t K,
+                       float *C, size_t ldc) {
+        auto row = [&](size_t m) {
+            return A + static_cast<size_t>(rows != nullptr ? rows[m] : m) * lda;
+        };
+        size_t m = 0;
+        for (; m + 4 <= M; m += 4) {
+            const float *a0 = row(m), *a1 = row(m + 1), *a2 = row(m + 2), *a3 = row(m + 3);
+            for (size_t j = 0; j < N; j++) {
+                const float *b = Bt + j * ldbt;
+                auto s0 = V::set1(0.0f), s1 = V::set1(0.0f), s2 = V::set1(0.0f), s3 = V::set1(0.0f);
+                size_t k = 0;
+                for (; k + V::width <= K; k += V::width) {
+                    const auto vb = V::load(b + k);
+                    s0 = V::fmadd(V::load(a0 + k), vb, s0);
+                    s1 = V::fmadd(V::load(a1 + k), vb, s1);
+                    s2 = V::fmadd(V::load(a2 + k), vb, s2);
+                    s3 = V::fmadd(V::load(a3 + k), vb, s3);
+                }
+                float r0 = V::reduce(s0), r1 = V::reduce(s1), r2 = V::reduce(s2), r3 = V::reduce(s3);
+                for (; k < K; k++) {
+                    r0 += a0[k] * b[k];
+                    r1 += a1[k] * b[k];
+                    r2 += a2[k] * b[k];
+                    r3 += a3[k] * b[k];
+                }
+                C[m * ldc + j] += r0;
+                C[(m + 1) * ldc + j] += r1;
+                C[(m + 2) * ldc + j] += r2;
+                C[(m + 3) * ldc + j] += r3;
+            }
+        }
+        for (; m < M; m++) {
+            for (size_t j = 0; j < N; j++) {
+                C[m * ldc + j] += Dot(row(m), Bt + j * ldbt, K);
+            }
+        }
+    }
+
+    static void Diagonal(const float *a, const float *x, float *y, size_t n) {
+        size_t i = 0;
+        for (; i + V::width <= n; i += V::width) {
+            V::store(y + i, V::fmadd(V::load(a + i), V::load(x + i), V::load(y + i)));
+        }
+        for (; i < n; i++) {
+            y[i] += a[i] * x[i];
+        }
+    }
+
+    static void Tanh(const float *in, float *out, size_t n) {
+        ApplyUnary<TanhOp>(in, out, n);
+    }
+
+    static void Sigmoid(const float *in, float *out, size_t n) {
+        ApplyUnary<SigmoidOp>(in, out, n);
+    }
+
+    static void LeakyRelu(const float *in, float *out, size_t n, float negativeSlope) {
+        ApplyUnary<LeakyReluOp>(in, out, n, negativeSlope);
+    }
+
+    static void Clamp(const float *in, float *out, size_t n, float low, float high) {
+        ApplyUnary<ClampOp>(in, out, n, low, high);
+    }
+
+    static void Abs(const float *in, float *out, size_t n) {
+        ApplyUnary<AbsOp>(in, out, n);
+    }
+
+    static void Sign(const float *in, float *out, size_t n) {
+        ApplyUnary<SignOp>(in, out, n);
+    }
+
+    static FloatMathKernels Get() {
+        FloatMathKernels kernels;
+        kernels.gemm_nt = &GemmNT;
+        kernels.dot = &Dot;
+        kernels.diagonal = &Diagonal;
+        kernels.tanh = &Tanh;
+        kernels.sigmoid = &Sigmoid;
+        kernels.leaky_relu = &LeakyRelu;
+        kernels.clamp = &Clamp;
+        kernels.abs = &Abs;
+        kernels.sign = &Sign;
+        return kernels;
+    }
+};
+
+}  // namespace
+}  // namespace runtime
+}  // namespace GNAPluginNS
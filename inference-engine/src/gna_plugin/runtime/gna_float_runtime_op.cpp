@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+
 #include "gna_float_runtime.hpp"
 #include "pwl.h"
 #include "cnn.h"
@@ -153,9 +156,17 @@ void FP::ApplyTranspose(intel_dnn_component_t *component) {
     // B = Transpose(A) where A is mxn and B is nxm
     auto A = reinterpret_cast<float *>(component->ptr_inputs);
     auto B = reinterpret_cast<float *>(component->ptr_outputs);
-    for (uint32_t row = 0; row < m; row++) {
-        for (uint32_t col = 0; col < n; col++) {
-            B[col * ldb + row] = A[row * lda + col];
+    // tiles keep both reads and strided writes within a few cache lines
+    const int tile = 16;
+    for (int row0 = 0; row0 < m; row0 += tile) {
+        const int rowEnd = std::min(row0 + tile, m);
+        for (int col0 = 0; col0 < n; col0 += tile) {
+            const int colEnd = std::min(col0 + tile, n);
+            for (int row = row0; row < rowEnd; row++) {
+                for (int col = col0; col < colEnd; col++) {
+                    B[col * ldb + row] = A[row * lda + col];
+                }
+            }
         }
     }
 }
@@ -176,9 +187,7 @@ void FP::ApplyCopy(intel_dnn_component_t *component) {
     }
     auto A = reinterpret_cast<float *>(src);
     auto B = reinterpret_cast<float *>(dst);
-    for (uint32_t row = 0; row < m; row++) {
-        for (uint32_t col = 0; col < n; col++) {
-            B[row * ldb + col] = A[row * lda + col];
-        }
+    for (int32_t row = 0; row < m; row++) {
+        std::memmove(B + row * ldb, A + row * lda, n * sizeof(float));
     }
 }
@@ -30,6 +30,7 @@
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
+#include "floatmath_kernels.hpp"
 
 double first_deriv_tanh(const double x) { return(1.0 - tanh(x) * tanh(x)); }
 double first_deriv_exp(const double x) { return(exp(x)); }
@@ -931,6 +932,23 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+// Calls the kernel for contiguous spans of the [rows] x [columns] block
+template <typename Kernel>
+static void ApplyToSpans(const float *ptr_in, float *ptr_out, uint32_t num_columns,
+                         uint32_t num_row_start, uint32_t num_row_end,
+                         uint32_t num_col_start, uint32_t num_col_end, Kernel kernel) {
+    const size_t span = num_col_end - num_col_start + 1;
+    if (span == num_columns) {
+        const size_t offset = static_cast<size_t>(num_row_start) * num_columns;
+        kernel(ptr_in + offset, ptr_out + offset, (num_row_end - num_row_start + 1) * span);
+        return;
+    }
+    for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+        const size_t offset = static_cast<size_t>(i) * num_columns + num_col_start;
+        kernel(ptr_in + offset, ptr_out + offset, span);
+    }
+}
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
@@ -940,20 +958,16 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    const auto& kernels = GNAPluginNS::runtime::GetFloatMathKernels();
+    auto applyKernel = [&](void (*kernel)(const float *, float *, size_t)) {
+        ApplyToSpans(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end, kernel);
+    };
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
+            applyKernel(kernels.sigmoid);
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
+            applyKernel(kernels.tanh);
             break;
         case kActSoftSign:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
@@ -962,36 +976,23 @@ void PwlApply32(intel_dnn_component_t *component,
                 }
             }
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
+        case kActRelu: {
+                const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+                ApplyToSpans(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                             [&](const float *in, float *out, size_t n) { kernels.leaky_relu(in, out, n, negative_slope); });
             }
             break;
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
+            if (ptr_in != ptr_out) {
+                ApplyToSpans(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                             [](const float *in, float *out, size_t n) { std::copy(in, in + n, out); });
             }
             break;
         case kActKaldiLstmClipping:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            ApplyToSpans(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                         [&](const float *in, float *out, size_t n) {
+                             kernels.clamp(in, out, n, KALDI_LSTM_CLIP_LOWER, KALDI_LSTM_CLIP_UPPER);
+                         });
             break;
         case kActExp:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
@@ -1008,18 +1009,10 @@ void PwlApply32(intel_dnn_component_t *component,
             }
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
-                }
-            }
+            applyKernel(kernels.abs);
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
-                }
-            }
+            applyKernel(kernels.sign);
             break;
         case kActNegLog:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
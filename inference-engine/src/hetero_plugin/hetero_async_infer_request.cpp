@@ -4,6 +4,8 @@
 
 #include <utility>
 #include <memory>
+#include <atomic>
+#include <vector>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -15,33 +17,82 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
     _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)),
     _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK} {
-    _pipeline.clear();
-    for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
-        struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
-                _inferRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [this] (InferRequest, StatusCode sts) mutable {
-                    _status = sts;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+    // Runs subnet requests as soon as the requests producing their inputs are finished, so independent
+    // subgraphs are inferred concurrently. The stage task is called when all requests are finished.
+    struct SubgraphsExecutor : ITaskExecutor {
+        SubgraphsExecutor(HeteroInferRequest::SubRequestsList& inferRequests, std::vector<StatusCode>& statusCodes) :
+            _inferRequests(inferRequests),
+            _statusCodes(statusCodes),
+            _pending{new std::atomic<std::size_t>[inferRequests.size()]} {
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                _inferRequests[requestId]._request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, requestId] (InferRequest, StatusCode sts) {
+                    _statusCodes[requestId] = sts;
+                    OnFinished(requestId);
                 });
             }
-            void run(Task task) override {
-                _task = std::move(task);
-                _inferRequest->StartAsync();
-            };
-            InferRequest*   _inferRequest = nullptr;
-            StatusCode      _status = StatusCode::OK;
-            Task            _task;
-        };
+        }
+        void run(Task task) override {
+            _task = std::move(task);
+            _failed = false;
+            _running = _inferRequests.size();
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                _statusCodes[requestId] = StatusCode::OK;
+                _pending[requestId] = _inferRequests[requestId]._predecessorsNum;
+            }
+            for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+                if (0 == _inferRequests[requestId]._predecessorsNum) {
+                    Start(requestId);
+                }
+            }
+        }
+        void Start(std::size_t requestId) {
+            // requests depending on a failed one are not started, but still counted as finished
+            if (_failed) {
+                OnFinished(requestId);
+                return;
+            }
+            try {
+                _inferRequests[requestId]._request->StartAsync();
+            } catch (InferenceEngine::details::InferenceEngineException& ex) {
+                _statusCodes[requestId] = ex.hasStatus() ? ex.getStatus() : StatusCode::GENERAL_ERROR;
+                OnFinished(requestId);
+            } catch (...) {
+                _statusCodes[requestId] = StatusCode::GENERAL_ERROR;
+                OnFinished(requestId);
+            }
+        }
+        void OnFinished(std::size_t requestId) {
+            if (StatusCode::OK != _statusCodes[requestId]) {
+                _failed = true;
+            }
+            for (auto successorId : _inferRequests[requestId]._successors) {
+                if (0 == --_pending[successorId]) {
+                    Start(successorId);
+                }
+            }
+            if (0 == --_running) {
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
+        }
+        HeteroInferRequest::SubRequestsList&            _inferRequests;
+        std::vector<StatusCode>&                        _statusCodes;
+        std::unique_ptr<std::atomic<std::size_t>[]>     _pending;
+        std::atomic<std::size_t>                        _running = {0};
+        std::atomic<bool>                               _failed = {false};
+        Task                                            _task;
+    };
 
-        auto reuestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request.get());
-        _pipeline.emplace_back(reuestExecutor, [reuestExecutor] {
-            if (StatusCode::OK != reuestExecutor->_status) {
-                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << reuestExecutor->_status;
+    auto subgraphsExecutor = std::make_shared<SubgraphsExecutor>(_heteroInferRequest->_inferRequests, _statusCodes);
+    _pipeline = {{subgraphsExecutor, [this] {
+        for (auto&& status : _statusCodes) {
+            if (StatusCode::OK != status) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
             }
-        });
-    }
+        }
+    }}};
+    _syncPipeline = _pipeline;
 }
 
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
@@ -49,6 +100,11 @@ void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    _heteroInferRequest->updateInOutIfNeeded();
+    InferUsingSync();
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
@@ -24,6 +24,7 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr&        callbackExecutor);
     ~HeteroAsyncInferRequest() override;
     void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
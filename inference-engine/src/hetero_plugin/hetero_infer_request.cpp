@@ -11,6 +11,8 @@
 #include <cassert>
 #include <map>
 #include <string>
+#include <algorithm>
+#include <unordered_map>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -62,6 +64,29 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
             requestBlob(inputInfo.first, desc._request);
         }
     }
+
+    // subnet requests depend only on requests producing their inputs, others may be inferred concurrently
+    std::unordered_map<std::string, std::size_t> producers;
+    for (std::size_t id = 0; id < _inferRequests.size(); ++id) {
+        for (auto&& outputInfo : _inferRequests[id]._network.GetOutputsInfo()) {
+            producers.emplace(outputInfo.first, id);
+        }
+    }
+    for (std::size_t id = 0; id < _inferRequests.size(); ++id) {
+        for (auto&& inputInfo : _inferRequests[id]._network.GetInputsInfo()) {
+            auto itName = subgraphInputToOutputBlobNames.find(inputInfo.first);
+            auto& intermediateBlobName = (itName != subgraphInputToOutputBlobNames.end()) ? itName->second : inputInfo.first;
+            auto itProducer = producers.find(intermediateBlobName);
+            if (itProducer == producers.end() || itProducer->second == id) {
+                continue;
+            }
+            auto& successors = _inferRequests[itProducer->second]._successors;
+            if (std::find(successors.begin(), successors.end(), id) == successors.end()) {
+                successors.push_back(id);
+                _inferRequests[id]._predecessorsNum++;
+            }
+        }
+    }
 }
 
 void HeteroInferRequest::SetBlob(const char* name, const InferenceEngine::Blob::Ptr& data) {
@@ -30,6 +30,8 @@ public:
         InferenceEngine::ExecutableNetwork  _network;
         InferenceEngine::InferRequest::Ptr  _request;
         openvino::itt::handle_t             _profilingTask;
+        std::vector<std::size_t>            _successors;    //!< Requests consuming outputs of this request
+        std::size_t                         _predecessorsNum = 0;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
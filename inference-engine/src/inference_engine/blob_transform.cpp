@@ -4,18 +4,70 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 
 //----------------------------------------------------------------------
 
 namespace InferenceEngine {
 
+/**
+ * @brief Copies a C x W plane between arbitrary strides. The plane is split into blocks of a cache line worth of
+ * channels, so the interleaved side of a block is read or written by whole cache lines, while the planar side
+ * is accessed sequentially.
+ */
+template <typename data_t>
+static inline void blob_copy_plane(const data_t* src_ptr, data_t* dst_ptr, size_t C, size_t W,
+                                   size_t C_src_stride, size_t W_src_stride, size_t C_dst_stride, size_t W_dst_stride) {
+    constexpr size_t C_block = 64 / sizeof(data_t);
+    constexpr size_t W_block = 256;
+    for (size_t w0 = 0; w0 < W; w0 += W_block) {
+        const size_t w1 = std::min(W, w0 + W_block);
+        for (size_t c0 = 0; c0 < C; c0 += C_block) {
+            const size_t c1 = std::min(C, c0 + C_block);
+            for (size_t c = c0; c < c1; c++) {
+                const data_t* src_ptr_l = src_ptr + c * C_src_stride;
+                data_t* dst_ptr_l = dst_ptr + c * C_dst_stride;
+                if (W_dst_stride == 1) {
+                    for (size_t w = w0; w < w1; w++) {
+                        dst_ptr_l[w] = src_ptr_l[w * W_src_stride];
+                    }
+                } else if (W_src_stride == 1) {
+                    for (size_t w = w0; w < w1; w++) {
+                        dst_ptr_l[w * W_dst_stride] = src_ptr_l[w];
+                    }
+                } else {
+                    for (size_t w = w0; w < w1; w++) {
+                        dst_ptr_l[w * W_dst_stride] = src_ptr_l[w * W_src_stride];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Bulk copy of a dense buffer split into chunks copied by several threads
+ */
+static inline void blob_copy_dense(const void* src_ptr, void* dst_ptr, size_t size) {
+    // a chunk is large enough to hide the threading overhead and small enough to balance large copies
+    constexpr size_t chunk = 256 * 1024;
+    const size_t chunks = (size + chunk - 1) / chunk;
+    parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * chunk;
+        std::memcpy(static_cast<uint8_t*>(dst_ptr) + offset, static_cast<const uint8_t*>(src_ptr) + offset,
+                    std::min(chunk, size - offset));
+    });
+}
+
 template <InferenceEngine::Precision::ePrecision PRC>
 static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
@@ -47,7 +99,7 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
     const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
 #ifdef HAVE_SSE
     if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
@@ -85,40 +137,14 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     }
 #endif  // HAVE_SSE
 
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
+    if ((src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) ||
+        (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC)) {
+        parallel_for2d(N, H, [&](size_t n, size_t h) {
+            blob_copy_plane(src_ptr + n * N_src_stride + h * H_src_stride, dst_ptr + n * N_dst_stride + h * H_dst_stride,
+                            C, W, C_src_stride, W_src_stride, C_dst_stride, W_dst_stride);
+        });
     } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        blob_copy_dense(src_ptr, dst_ptr, N * C * H * W * sizeof(data_t));
     }
 }
 
@@ -219,44 +245,15 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
         }
     }
 #endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
+    if ((src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) ||
+        (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC)) {
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            blob_copy_plane(src_ptr + n * N_src_stride + d * D_src_stride + h * H_src_stride,
+                            dst_ptr + n * N_dst_stride + d * D_dst_stride + h * H_dst_stride,
+                            C, W, C_src_stride, W_src_stride, C_dst_stride, W_dst_stride);
+        });
     } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+        blob_copy_dense(src_ptr, dst_ptr, N * C * D * H * W * sizeof(data_t));
     }
 }
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -22,6 +23,7 @@
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "ie_network_cache.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -175,6 +177,50 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    std::shared_ptr<details::NetworkCache> networkCache;
+    std::string networkCacheDir;
+    std::uint64_t networkCacheSizeLimit = 0;
+    mutable std::mutex networkCacheMutex;  // to lock parallel access to network cache settings
+
+    std::shared_ptr<details::NetworkCache> GetNetworkCache() const {
+        std::lock_guard<std::mutex> lock(networkCacheMutex);
+        return networkCache;
+    }
+
+    /**
+     * @brief Checks whether a network can be stored in network cache
+     * @note Pre-processing is a part of InputInfo, but it is not preserved by Export / Import
+     */
+    static bool IsCacheable(const CNNNetwork& network, const std::string& deviceName) {
+        if (network.getFunction() == nullptr || deviceName == "MULTI") {
+            return false;
+        }
+        for (auto&& input : network.getInputsInfo()) {
+            const auto& preProcess = input.second->getPreProcess();
+            if (preProcess.getResizeAlgorithm() != ResizeAlgorithm::NO_RESIZE ||
+                preProcess.getColorFormat() != ColorFormat::RAW ||
+                preProcess.getMeanVariant() != MeanVariant::NONE) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks whether a device imports exported networks without compiling them again,
+     *        otherwise caching gives no benefit
+     */
+    static bool SupportsImportExport(const InferencePlugin& plugin) {
+        try {
+            std::vector<std::string> supportedMetrics = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+            return std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)) !=
+                       supportedMetrics.end() &&
+                   plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -271,7 +317,42 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+
+        auto cache = GetNetworkCache();
+        if (cache == nullptr || !IsCacheable(network, parsed._deviceName) || !SupportsImportExport(plugin)) {
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+
+        // plugin defaults set via Core::SetConfig affect compilation as well
+        auto compileConfig = GetPluginDefaultConfig(parsed._deviceName);
+        for (auto&& item : parsed._config) {
+            compileConfig[item.first] = item.second;
+        }
+        std::string key;
+        try {
+            key = details::NetworkCache::ComputeKey(network, parsed._deviceName, compileConfig, plugin.GetVersion());
+        } catch (const std::exception&) {
+            // e.g. networks with dynamic shapes cannot be serialized
+            return plugin.LoadNetwork(network, parsed._config);
+        }
+
+        ExecutableNetwork executableNetwork;
+        if (cache->Load(key, [&](std::istream& blob) {
+                executableNetwork = plugin.ImportNetwork(blob, parsed._config);
+            })) {
+            return executableNetwork;
+        }
+
+        executableNetwork = plugin.LoadNetwork(network, parsed._config);
+        try {
+            cache->Store(key, [&](std::ostream& blob) {
+                executableNetwork.Export(blob);
+            });
+        } catch (const std::exception&) {
+            // caching is the best effort, e.g. device does not implement Export
+        }
+        return executableNetwork;
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -447,6 +528,41 @@ public:
         return listOfDevices;
     }
 
+    /**
+     * @brief Returns configuration set for a device via Core::SetConfig or plugins.xml
+     * @param deviceName A device name
+     */
+    std::map<std::string, std::string> GetPluginDefaultConfig(const std::string& deviceName) const {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        auto it = pluginRegistry.find(deviceName);
+        return it == pluginRegistry.end() ? std::map<std::string, std::string>{} : it->second.defaultConfig;
+    }
+
+    /**
+     * @brief Sets Core level network cache settings
+     * @param config A config with NETWORK_CACHE_DIR and / or NETWORK_CACHE_SIZE_LIMIT keys
+     */
+    void SetNetworkCacheConfig(const std::map<std::string, std::string>& config) {
+        std::lock_guard<std::mutex> lock(networkCacheMutex);
+
+        auto dirIt = config.find(CONFIG_KEY(NETWORK_CACHE_DIR));
+        if (dirIt != config.end()) {
+            networkCacheDir = dirIt->second;
+        }
+        auto sizeIt = config.find(CONFIG_KEY(NETWORK_CACHE_SIZE_LIMIT));
+        if (sizeIt != config.end()) {
+            try {
+                networkCacheSizeLimit = std::stoull(sizeIt->second);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value " << sizeIt->second << " for property key "
+                                   << CONFIG_KEY(NETWORK_CACHE_SIZE_LIMIT) << ". Expected only non-negative integer numbers";
+            }
+        }
+
+        networkCache = networkCacheDir.empty() ? nullptr :
+            std::make_shared<details::NetworkCache>(networkCacheDir, networkCacheSizeLimit);
+    }
+
     /**
      * @brief Sets config values for a plugin or set of plugins
      * @param deviceName A device name to set config to
@@ -684,7 +800,27 @@ QueryNetworkResult Core::QueryNetwork(const CNNNetwork& network, const std::stri
     return _impl->QueryNetwork(network, deviceName, config);
 }
 
-void Core::SetConfig(const std::map<std::string, std::string>& config, const std::string& deviceName) {
+void Core::SetConfig(const std::map<std::string, std::string>& config_, const std::string& deviceName) {
+    // Core level settings are not passed to plugins
+    auto config = config_;
+    std::map<std::string, std::string> cacheConfig;
+    for (auto&& key : {CONFIG_KEY(NETWORK_CACHE_DIR), CONFIG_KEY(NETWORK_CACHE_SIZE_LIMIT)}) {
+        auto it = config.find(key);
+        if (it != config.end()) {
+            cacheConfig.insert(*it);
+            config.erase(it);
+        }
+    }
+    if (!cacheConfig.empty()) {
+        if (!deviceName.empty()) {
+            THROW_IE_EXCEPTION << "Network cache can be configured only for the Core itself (without devices).";
+        }
+        _impl->SetNetworkCacheConfig(cacheConfig);
+        if (config.empty()) {
+            return;
+        }
+    }
+
     // HETERO case
     {
         if (deviceName.find("HETERO:") == 0) {
@@ -0,0 +1,327 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_network_cache.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <ie_version.hpp>
+#include <ngraph/graph_util.hpp>
+#include <transformations/serialize.hpp>
+#include <transformations/utils/data_hash.hpp>
+
+#include "ie_itt.hpp"
+
+#ifndef _WIN32
+# include <dirent.h>
+# include <sys/stat.h>
+# include <sys/types.h>
+# include <unistd.h>
+# include <utime.h>
+#else
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <Windows.h>
+# include <direct.h>
+# include <sys/utime.h>
+#endif
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+constexpr const char* blobExtension = ".blob";
+
+/**
+ * @brief Output stream buffer which does not store data, but computes 64-bit xxHash64 of it,
+ *        so weights are hashed a word at a time instead of a byte at a time.
+ *        Tracks the current position, so tellp() works as for a regular stream.
+ */
+class HashStreamBuf : public std::streambuf {
+public:
+    /**
+     * @brief Returns the hash of the data written so far as 16 hexadecimal digits
+     */
+    std::string hash() const {
+        std::stringstream hash;
+        hash << std::hex << std::setfill('0') << std::setw(16) << _hasher.digest();
+        return hash.str();
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        _hasher.update(s, static_cast<std::size_t>(n));
+        _size += n;
+        return n;
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override {
+        if (off == 0 && dir == std::ios_base::cur) {
+            return pos_type(_size);
+        }
+        return pos_type(off_type(-1));
+    }
+
+private:
+    ngraph::DataHash _hasher;
+    std::streamsize _size = 0;
+};
+
+struct BlobInfo {
+    std::string path;
+    std::uint64_t size;
+    std::uint64_t timestamp;
+};
+
+bool hasBlobExtension(const std::string& name) {
+    const std::string extension = blobExtension;
+    return name.size() > extension.size() &&
+           name.compare(name.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+std::vector<BlobInfo> listBlobs(const std::string& dir) {
+    std::vector<BlobInfo> blobs;
+#ifndef _WIN32
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return blobs;
+    }
+    while (dirent* entry = readdir(dirHandle)) {
+        std::string name = entry->d_name;
+        if (!hasBlobExtension(name)) {
+            continue;
+        }
+        std::string path = dir + "/" + name;
+        struct stat fileStat;
+        if (stat(path.c_str(), &fileStat) == 0 && S_ISREG(fileStat.st_mode)) {
+            blobs.push_back({path, static_cast<std::uint64_t>(fileStat.st_size),
+                             static_cast<std::uint64_t>(fileStat.st_mtime)});
+        }
+    }
+    closedir(dirHandle);
+#else
+    WIN32_FIND_DATAA findData;
+    HANDLE findHandle = FindFirstFileA((dir + "\\*" + blobExtension).c_str(), &findData);
+    if (findHandle == INVALID_HANDLE_VALUE) {
+        return blobs;
+    }
+    do {
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            continue;
+        }
+        std::uint64_t size = (static_cast<std::uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+        std::uint64_t timestamp = (static_cast<std::uint64_t>(findData.ftLastWriteTime.dwHighDateTime) << 32) |
+                                  findData.ftLastWriteTime.dwLowDateTime;
+        blobs.push_back({dir + "\\" + findData.cFileName, size, timestamp});
+    } while (FindNextFileA(findHandle, &findData));
+    FindClose(findHandle);
+#endif
+    return blobs;
+}
+
+void touchFile(const std::string& path) {
+#ifndef _WIN32
+    utime(path.c_str(), nullptr);
+#else
+    _utime(path.c_str(), nullptr);
+#endif
+}
+
+void makeDirectory(const std::string& path) {
+#ifndef _WIN32
+    mkdir(path.c_str(), 0755);
+#else
+    _mkdir(path.c_str());
+#endif
+}
+
+std::string uniqueTempSuffix() {
+    std::stringstream suffix;
+#ifndef _WIN32
+    suffix << ".tmp" << getpid() << "_" << std::this_thread::get_id();
+#else
+    suffix << ".tmp" << GetCurrentProcessId() << "_" << std::this_thread::get_id();
+#endif
+    return suffix.str();
+}
+
+}  // namespace
+
+NetworkCache::NetworkCache(const std::string& cacheDir, std::uint64_t sizeLimit) :
+    _cacheDir{cacheDir},
+    _sizeLimit{sizeLimit} {
+}
+
+std::string NetworkCache::ComputeKey(const CNNNetwork& network,
+                                     const std::string& deviceName,
+                                     const std::map<std::string, std::string>& config,
+                                     const Version& pluginVersion) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCache::ComputeKey");
+
+    auto function = network.getFunction();
+    if (function == nullptr) {
+        THROW_IE_EXCEPTION << "Network cache supports only ngraph::Function based networks";
+    }
+
+    HashStreamBuf hashBuf;
+    std::ostream hashStream(&hashBuf);
+
+    // IR v10 representation is used as canonical form of the network, weights are hashed without storing them
+    ngraph::pass::Serialize serializer(hashStream, hashStream);
+    serializer.run_on_function(ngraph::clone_function(*function));
+
+    // inputs / outputs info is set by user and is not a part of ngraph::Function
+    for (auto&& input : network.getInputsInfo()) {
+        hashStream << input.first << ' ' << input.second->getPrecision().name() << ' '
+                   << static_cast<unsigned>(input.second->getLayout()) << '\n';
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        hashStream << output.first << ' ' << output.second->getPrecision().name() << ' '
+                   << static_cast<unsigned>(output.second->getLayout()) << '\n';
+    }
+
+    // everything except the network itself is kept as is to be compared on load
+    std::stringstream key;
+    key << "network " << hashBuf.hash() << '\n';
+    key << "device " << deviceName << '\n';
+    for (auto&& item : config) {
+        key << "config " << item.first << '=' << item.second << '\n';
+    }
+    key << "inference_engine " << GetInferenceEngineVersion()->buildNumber << '\n';
+    key << "plugin " << pluginVersion.apiVersion.major << '.' << pluginVersion.apiVersion.minor << ' '
+        << (pluginVersion.buildNumber ? pluginVersion.buildNumber : "") << ' '
+        << (pluginVersion.description ? pluginVersion.description : "") << '\n';
+    return key.str();
+}
+
+std::string NetworkCache::GetBlobPath(const std::string& key) const {
+    HashStreamBuf hashBuf;
+    std::ostream hashStream(&hashBuf);
+    hashStream << key;
+#ifndef _WIN32
+    return _cacheDir + "/" + hashBuf.hash() + blobExtension;
+#else
+    return _cacheDir + "\\" + hashBuf.hash() + blobExtension;
+#endif
+}
+
+bool NetworkCache::Load(const std::string& key, const std::function<void(std::istream&)>& reader) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCache::Load");
+
+    const auto blobPath = GetBlobPath(key);
+    {
+        std::ifstream blobFile(blobPath, std::ios::in | std::ios::binary);
+        if (!blobFile.is_open()) {
+            return false;
+        }
+
+        // the blob is overwritten by Store once the network is compiled for this key
+        std::uint64_t storedKeySize = 0;
+        blobFile.read(reinterpret_cast<char*>(&storedKeySize), sizeof(storedKeySize));
+        if (!blobFile || storedKeySize != key.size()) {
+            return false;
+        }
+        std::string storedKey(key.size(), '\0');
+        blobFile.read(&storedKey[0], storedKey.size());
+        if (!blobFile || storedKey != key) {
+            return false;
+        }
+
+        try {
+            reader(blobFile);
+        } catch (const std::exception&) {
+            blobFile.close();
+            // the blob is corrupted or was produced by incompatible plugin, it will be recompiled
+            std::remove(blobPath.c_str());
+            return false;
+        }
+    }
+    // most recently used blobs are evicted last
+    touchFile(blobPath);
+    return true;
+}
+
+void NetworkCache::Store(const std::string& key, const std::function<void(std::ostream&)>& writer) const {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCache::Store");
+
+    makeDirectory(_cacheDir);
+
+    const auto blobPath = GetBlobPath(key);
+    const auto tempPath = blobPath + uniqueTempSuffix();
+    {
+        std::ofstream tempFile(tempPath, std::ios::out | std::ios::binary);
+        if (!tempFile.is_open()) {
+            // cache directory is not writable, just do not cache
+            return;
+        }
+        try {
+            std::uint64_t keySize = key.size();
+            tempFile.write(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+            tempFile.write(key.data(), key.size());
+            writer(tempFile);
+        } catch (...) {
+            tempFile.close();
+            std::remove(tempPath.c_str());
+            throw;
+        }
+        tempFile.close();
+        if (!tempFile) {
+            std::remove(tempPath.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tempPath.c_str(), blobPath.c_str()) != 0) {
+        // e.g. on Windows the blob is already stored by a concurrent writer
+        std::remove(tempPath.c_str());
+        return;
+    }
+
+    if (_sizeLimit != 0) {
+        Trim();
+    }
+}
+
+void NetworkCache::Trim() const {
+    auto blobs = listBlobs(_cacheDir);
+    std::uint64_t totalSize = 0;
+    for (auto&& blob : blobs) {
+        totalSize += blob.size;
+    }
+    if (totalSize <= _sizeLimit) {
+        return;
+    }
+
+    std::sort(blobs.begin(), blobs.end(), [](const BlobInfo& lhs, const BlobInfo& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+    for (auto&& blob : blobs) {
+        if (totalSize <= _sizeLimit) {
+            break;
+        }
+        if (std::remove(blob.path.c_str()) == 0) {
+            totalSize -= blob.size;
+        }
+    }
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_version.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief On-disk cache of exported executable networks used by Core::LoadNetwork
+ *
+ * Blobs are named by a hash of the key. Each blob starts with the full key, which is compared on load,
+ * so neither a collision of names nor a blob left by another version of a plugin is imported.
+ * Writes go to a temporary file which is renamed into place, so concurrent processes
+ * sharing the same directory never observe partially written blobs.
+ */
+class NetworkCache {
+public:
+    /**
+     * @brief Creates a cache in a directory, the directory is created on first store
+     * @param cacheDir A directory to keep exported networks in
+     * @param sizeLimit Maximum total size of cached blobs in bytes, 0 means unlimited
+     */
+    NetworkCache(const std::string& cacheDir, std::uint64_t sizeLimit);
+
+    /**
+     * @brief Computes a key of the network compiled for a device with a given configuration
+     * @param network A network with ngraph::Function representation
+     * @param deviceName A device name without device ID
+     * @param config Compilation configuration, including plugin defaults
+     * @param pluginVersion A version of the plugin compiling the network
+     * @return A key which can be passed to Load and Store. It holds a 64-bit hash of the network and
+     *         its inputs / outputs info, the device name, the configuration and the versions as is
+     */
+    static std::string ComputeKey(const CNNNetwork& network,
+                                  const std::string& deviceName,
+                                  const std::map<std::string, std::string>& config,
+                                  const Version& pluginVersion);
+
+    /**
+     * @brief Opens a blob for the key and passes it to the reader
+     * @param key A key computed by ComputeKey
+     * @param reader A callback importing the network from a stream
+     * @return false if there is no blob for the key or the reader has thrown, true otherwise
+     * @note A blob which was stored for another key is not passed to the reader,
+     *       a blob which cannot be imported is removed from the cache
+     */
+    bool Load(const std::string& key, const std::function<void(std::istream&)>& reader) const;
+
+    /**
+     * @brief Atomically stores a blob produced by the writer and evicts the oldest blobs above the size limit
+     * @param key A key computed by ComputeKey
+     * @param writer A callback exporting the network to a stream
+     */
+    void Store(const std::string& key, const std::function<void(std::ostream&)>& writer) const;
+
+private:
+    std::string GetBlobPath(const std::string& key) const;
+    void Trim() const;
+
+    std::string _cacheDir;
+    std::uint64_t _sizeLimit;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
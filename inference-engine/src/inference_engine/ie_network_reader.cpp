@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -153,6 +154,28 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
         "version of the OpenVINO to generate supported IR version.";
 }
 
+/**
+ * @brief Maps weights file into memory
+ * @return U8 blob backed by the file mapping or nullptr if the file cannot be mapped
+ */
+Blob::Ptr mapWeights(const std::string& binPath) {
+    std::shared_ptr<IAllocator> allocator;
+    try {
+        allocator = details::shared_from_irelease(new details::MmapAllocator(binPath));
+    } catch (const details::InferenceEngineException&) {
+        return nullptr;
+    }
+    size_t fileSize = std::static_pointer_cast<details::MmapAllocator>(allocator)->fileSize();
+    if (fileSize == 0)
+        return nullptr;
+
+    auto weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C }, allocator);
+    weights->allocate();
+    if (weights->cbuffer().as<const uint8_t*>() == nullptr)
+        return nullptr;
+    return weights;
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -200,6 +223,13 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
             }
             if (!bPath.empty()) {
                 // Open weights file
+                // read model with memory mapped weights, pages are loaded when plugins access them
+                if (auto weights = mapWeights(bPath)) {
+                    auto network = reader->read(modelStream, weights, exts);
+                    modelStream.close();
+                    return network;
+                }
+
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
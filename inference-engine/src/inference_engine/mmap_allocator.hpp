@@ -0,0 +1,60 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Allocator which maps a file into memory instead of allocating heap memory
+ *
+ * The file is mapped privately: pages are loaded on first access and are shared between
+ * processes mapping the same file until they are written (copy-on-write).
+ */
+class MmapAllocator : public IAllocator {
+public:
+    /**
+     * @brief Opens a file to be mapped
+     * @param path A path to the file
+     */
+    explicit MmapAllocator(const std::string& path);
+
+    ~MmapAllocator() override;
+
+    /**
+     * @brief Returns the size of the opened file in bytes
+     */
+    std::size_t fileSize() const noexcept;
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    /**
+     * @brief Maps the first `size` bytes of the file
+     * @return An address of the mapping or nullptr if size exceeds the file size or mapping fails
+     */
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "details/ie_exception.hpp"
+#include "mmap_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+class MmapAllocator::Impl {
+public:
+    int fd = -1;
+    std::size_t fileSize = 0;
+    void* address = nullptr;
+    std::size_t mappedSize = 0;
+};
+
+MmapAllocator::MmapAllocator(const std::string& path) : _impl(new Impl) {
+    _impl->fd = open(path.c_str(), O_RDONLY);
+    if (_impl->fd == -1)
+        THROW_IE_EXCEPTION << "Cannot open file " << path << " for mapping: " << std::strerror(errno);
+
+    struct stat fileStat;
+    if (fstat(_impl->fd, &fileStat) == -1) {
+        close(_impl->fd);
+        THROW_IE_EXCEPTION << "Cannot get size of file " << path << ": " << std::strerror(errno);
+    }
+    _impl->fileSize = static_cast<std::size_t>(fileStat.st_size);
+}
+
+MmapAllocator::~MmapAllocator() {
+    free(_impl->address);
+    close(_impl->fd);
+}
+
+std::size_t MmapAllocator::fileSize() const noexcept {
+    return _impl->fileSize;
+}
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (_impl->address != nullptr || size == 0 || size > _impl->fileSize)
+        return nullptr;
+
+    // private writable mapping keeps the file intact if someone modifies weights in place
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, _impl->fd, 0);
+    if (address == MAP_FAILED)
+        return nullptr;
+
+    _impl->address = address;
+    _impl->mappedSize = size;
+    return address;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _impl->address)
+        return false;
+
+    munmap(_impl->address, _impl->mappedSize);
+    _impl->address = nullptr;
+    _impl->mappedSize = 0;
+    return true;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "details/ie_exception.hpp"
+#include "file_utils.h"
+#include "mmap_allocator.hpp"
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace InferenceEngine {
+namespace details {
+
+class MmapAllocator::Impl {
+public:
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+    std::size_t fileSize = 0;
+    void* address = nullptr;
+};
+
+MmapAllocator::MmapAllocator(const std::string& path) : _impl(new Impl) {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    std::wstring widePath = FileUtils::multiByteCharToWString(path.c_str());
+    _impl->file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+    _impl->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#endif
+    if (_impl->file == INVALID_HANDLE_VALUE)
+        THROW_IE_EXCEPTION << "Cannot open file " << path << " for mapping: error " << GetLastError();
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(_impl->file, &size)) {
+        CloseHandle(_impl->file);
+        THROW_IE_EXCEPTION << "Cannot get size of file " << path << ": error " << GetLastError();
+    }
+    _impl->fileSize = static_cast<std::size_t>(size.QuadPart);
+}
+
+MmapAllocator::~MmapAllocator() {
+    free(_impl->address);
+    CloseHandle(_impl->file);
+}
+
+std::size_t MmapAllocator::fileSize() const noexcept {
+    return _impl->fileSize;
+}
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (_impl->address != nullptr || size == 0 || size > _impl->fileSize)
+        return nullptr;
+
+    // copy-on-write mapping keeps the file intact if someone modifies weights in place
+    _impl->mapping = CreateFileMappingA(_impl->file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (_impl->mapping == NULL)
+        return nullptr;
+
+    _impl->address = MapViewOfFile(_impl->mapping, FILE_MAP_COPY, 0, 0, size);
+    if (_impl->address == nullptr) {
+        CloseHandle(_impl->mapping);
+        _impl->mapping = NULL;
+    }
+    return _impl->address;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    if (handle == nullptr || handle != _impl->address)
+        return false;
+
+    UnmapViewOfFile(_impl->address);
+    CloseHandle(_impl->mapping);
+    _impl->address = nullptr;
+    _impl->mapping = NULL;
+    return true;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -106,6 +106,24 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) {
+                parallelBranches = true;
+            } else if (val == PluginConfigParams::NO) {
+                parallelBranches = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                    << ". Expected only YES/NO";
+            }
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_ACTIVATIONS) {
+            if (val == PluginConfigParams::YES) {
+                sharedActivations = true;
+            } else if (val == PluginConfigParams::NO) {
+                sharedActivations = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_ACTIVATIONS
+                    << ". Expected only YES/NO";
+            }
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -150,6 +168,14 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (parallelBranches)
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
+        if (sharedActivations)
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_ACTIVATIONS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_SHARED_ACTIVATIONS, PluginConfigParams::NO });
     }
 }
 
@@ -0,0 +1,104 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_activation_arena.hpp"
+
+#include <algorithm>
+
+#if defined(__linux__)
+# include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr size_t cacheLineSize = 64;
+constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+}  // namespace
+
+MKLDNNActivationArena::Block::Block(size_t size) : size(size) {
+    // large blocks are aligned to huge pages, so the kernel may back them by huge pages and save TLB misses
+    // on the activations which are read and written by every layer
+    const size_t alignment = size >= hugePageSize ? hugePageSize : cacheLineSize;
+    storage.reset(new int8_t[size + alignment]);
+    const auto address = reinterpret_cast<uintptr_t>(storage.get());
+    data = storage.get() + (alignment - address % alignment) % alignment;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (size >= hugePageSize) {
+        // it is only a hint, the memory is used as is if transparent huge pages are disabled
+        madvise(data, size - size % hugePageSize, MADV_HUGEPAGE);
+    }
+#endif
+}
+
+std::shared_ptr<MKLDNNActivationArena::Block> MKLDNNActivationArena::Acquire(size_t size, const void* preferredData) {
+    std::unique_ptr<Block> block;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto fits = [&](const std::unique_ptr<Block>& free) { return free->GetSize() >= size; };
+        auto found = std::find_if(freeBlocks.begin(), freeBlocks.end(), [&](const std::unique_ptr<Block>& free) {
+            return free->GetData() == preferredData && fits(free);
+        });
+        if (found == freeBlocks.end()) {
+            // the smallest fitting block leaves larger ones to larger graphs
+            for (auto it = freeBlocks.begin(); it != freeBlocks.end(); ++it) {
+                if (fits(*it) && (found == freeBlocks.end() || (*it)->GetSize() < (*found)->GetSize()))
+                    found = it;
+            }
+        }
+        if (found == freeBlocks.end() && !freeBlocks.empty()) {
+            // all free blocks are too small, the largest of them is replaced by a new one
+            found = std::max_element(freeBlocks.begin(), freeBlocks.end(),
+                                     [](const std::unique_ptr<Block>& lhs, const std::unique_ptr<Block>& rhs) {
+                return lhs->GetSize() < rhs->GetSize();
+            });
+            allocatedSize -= (*found)->GetSize();
+            freeBlocks.erase(found);
+            found = freeBlocks.end();
+        }
+        if (found != freeBlocks.end()) {
+            block = std::move(*found);
+            freeBlocks.erase(found);
+        }
+    }
+
+    if (!block) {
+        block.reset(new Block(size));
+        std::lock_guard<std::mutex> lock(guard);
+        allocatedSize += size;
+    }
+
+    // the lease keeps the arena alive, so it may outlive the graphs using the arena
+    auto arena = shared_from_this();
+    return std::shared_ptr<Block>(block.release(), [arena](Block* leased) {
+        arena->Release(leased);
+    });
+}
+
+void MKLDNNActivationArena::Release(Block* block) {
+    std::unique_ptr<Block> released(block);
+    std::lock_guard<std::mutex> lock(guard);
+    freeBlocks.push_back(std::move(released));
+}
+
+size_t MKLDNNActivationArena::GetAllocatedSize() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return allocatedSize;
+}
+
+std::shared_ptr<MKLDNNActivationArena> MKLDNNActivationArena::GetInstance() {
+    static std::mutex instanceGuard;
+    static std::weak_ptr<MKLDNNActivationArena> instance;
+    std::lock_guard<std::mutex> lock(instanceGuard);
+    auto arena = instance.lock();
+    if (!arena) {
+        arena = std::make_shared<MKLDNNActivationArena>();
+        instance = arena;
+    }
+    return arena;
+}
+
+}  // namespace MKLDNNPlugin
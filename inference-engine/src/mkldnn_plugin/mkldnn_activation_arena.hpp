@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process-wide pool of memory blocks for intermediate data of graphs (see KEY_CPU_SHARED_ACTIVATIONS)
+ *
+ * A graph leases a block for the time of one inference, so graphs which are not executed at the same moment
+ * use the same memory. A new block is allocated only if all blocks are leased, and a free block which is too
+ * small for a request is replaced by the new one. So the number of blocks doesn't exceed the number of
+ * concurrent inferences in the process.
+ *
+ * Is thread safe.
+ */
+class MKLDNNActivationArena : public std::enable_shared_from_this<MKLDNNActivationArena> {
+public:
+    class Block {
+    public:
+        explicit Block(size_t size);
+
+        void* GetData() const { return data; }
+        size_t GetSize() const { return size; }
+
+    private:
+        std::unique_ptr<int8_t[]> storage;
+        void* data = nullptr;
+        size_t size = 0;
+    };
+
+    /**
+     * Leases a free block of at least size bytes, the block with preferredData is returned if it fits.
+     * The block is returned to the arena on destruction of the lease, its data are not preserved.
+     */
+    std::shared_ptr<Block> Acquire(size_t size, const void* preferredData = nullptr);
+
+    /**
+     * Total size of all blocks allocated by the arena, both leased and free
+     */
+    size_t GetAllocatedSize() const;
+
+    /**
+     * Returns the arena shared by all graphs of the process. The arena is owned by the graphs using it and by
+     * the leases, so its blocks are freed when the last of them is destroyed.
+     */
+    static std::shared_ptr<MKLDNNActivationArena> GetInstance();
+
+private:
+    void Release(Block* block);
+
+    mutable std::mutex guard;
+    std::vector<std::unique_ptr<Block>> freeBlocks;
+    size_t allocatedSize = 0;
+};
+
+}  // namespace MKLDNNPlugin
@@ -25,6 +25,10 @@
 #include <utility>
 #include <cstring>
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <transformations/serialize.hpp>
+#include <ngraph/graph_util.hpp>
+#include <pugixml.hpp>
+#include <sstream>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -39,9 +43,11 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const std::shared_ptr<const ngraph::Function> &originalFunction) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
+    _originalFunction{originalFunction},
     _cfg{cfg},
     _name{network.getName()} {
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
@@ -157,12 +163,24 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    _preprocessingExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        IStreamsExecutor::Config{"CPUPreprocessingExecutor"});
+
+    // Topology optimizations and selection of primitive descriptors give the same result for all streams,
+    // so they are done once and each stream only allocates memory and creates primitives for its copy.
+    // The prototype is compiled from the cloned network itself, which is not needed anymore if it succeeds:
+    // a failed prototype only replicates the network and does not change it.
+    if (_cfg.streamExecutorConfig._streams != 1) {
+        _graphPrototype = std::make_shared<MKLDNNGraph>();
+        _graphPrototype->setConfig(_cfg);
+        if (_graphPrototype->CreatePrototype(static_cast<ICNNNetwork&>(*_clonedNetwork), extensionManager)) {
+            _clonedNetwork.reset();
+        } else {
+            _graphPrototype.reset();
+        }
+    }
 
     _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
-
         auto graph = std::make_shared<MKLDNNGraph>();
         {
             std::unique_lock<std::mutex> lock{_cfgMutex};
@@ -174,6 +192,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             numaNode = streamExecutor->GetNumaNodeId();
         }
 
+        if (_graphPrototype) {
+            graph->CreateGraph(*_graphPrototype, numaNodesWeights[numaNode]);
+            return graph;
+        }
+
+        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+        //       is fixed and does not change content of network passed (CVS-26420)
+        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
         graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
         return graph;
     }};
@@ -212,7 +238,7 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>(_preprocessingExecutor);
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -222,6 +248,62 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& modelStream) {
+    // The network is compiled again on import, so the plugin does not report IMPORT_EXPORT_SUPPORT
+    // and Core does not cache CPU networks. The export only makes the network self-contained.
+    if (_originalFunction == nullptr) {
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED) << "CPU plugin can export only networks represented by ngraph::Function";
+    }
+
+    // Header: exported configuration and user defined inputs / outputs info
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("version").set_value(1);
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<unsigned>(networkInput.second->getLayout()));
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<unsigned>(networkOutput.second->getLayout()));
+    }
+
+    doc.save(modelStream, nullptr, pugi::format_raw);
+    modelStream << std::endl;
+
+    // Body: the network as IR v10, both parts are prefixed with their size
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile);
+    serializer.run_on_function(ngraph::clone_function(*_originalFunction));
+
+    for (auto&& section : {xmlFile.str(), binFile.str()}) {
+        std::uint64_t dataSize = section.size();
+        modelStream.write(reinterpret_cast<const char*>(&dataSize), sizeof(dataSize));
+        modelStream.write(section.data(), section.size());
+    }
+    if (!modelStream.good()) {
+        THROW_IE_EXCEPTION << "Error during CPU network export";
+    }
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -30,7 +30,8 @@ public:
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const std::shared_ptr<const ngraph::Function> &originalFunction = nullptr);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -42,20 +43,30 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& modelStream) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    // Graph compiled once and copied by the streams, its nodes keep the layers of the network alive.
+    // It is empty if the network has nodes which cannot be copied.
+    MKLDNNGraph::Ptr                            _graphPrototype;
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
 protected:
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
+    // Network the graphs are created from, it is released if the graphs are copied from the prototype
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
+    // Untransformed copy of the loaded network for Export, constants data is shared with the user's network
+    std::shared_ptr<const ngraph::Function>     _originalFunction;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // Runs input pre-processing of the requests while the task executor infers other requests
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessingExecutor;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
@@ -12,6 +12,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <functional>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -22,9 +23,12 @@
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include <legacy/net_pass.h>
 #include <legacy/details/ie_cnn_network_tools.h>
@@ -36,6 +40,10 @@
 
 #include "utils/blob_dump.h"
 
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+#include <tbb/task_group.h>
+#endif
+
 /*****************************************************
  * Debug capability
  *  - BLOB_DUMP_PATH : Specify with existing folder name
@@ -62,6 +70,81 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+/**
+ * Calls func for each node in parallel using TBB, or sequentially for other threading backends.
+ * Nodes are distributed dynamically, since heavy nodes are usually adjacent in the execution order.
+ * If several nodes throw, the exception of the first one in the order is rethrown regardless of scheduling.
+ * func must not write state shared with other nodes, such as lazily resolved dims and descs of edges.
+ */
+template <typename F>
+void parallelForNodes(const std::vector<MKLDNNNodePtr>& nodes, const F& func) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    std::vector<std::exception_ptr> exceptions(nodes.size());
+    tbb::parallel_for(size_t(0), nodes.size(), [&](size_t i) {
+        try {
+            // isolation prevents a thread waiting inside the node from taking another node,
+            // which would reuse thread local resources (e.g. primitives scratchpad) of the first one
+            tbb::this_task_arena::isolate([&] {
+                func(nodes[i]);
+            });
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    });
+    for (auto& exception : exceptions) {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+#else
+    for (auto& node : nodes) {
+        func(node);
+    }
+#endif
+}
+
+/**
+ * Computes level of each constant node: nodes without constant parents have level 0, other nodes are
+ * placed one level below their deepest constant parent. Nodes of the same level don't depend on each other.
+ * Expects nodes sorted topologically.
+ */
+std::unordered_map<MKLDNNNode*, int> getConstantNodesLevels(const std::vector<MKLDNNNodePtr>& nodes) {
+    std::unordered_map<MKLDNNNode*, int> levels;
+    for (auto& node : nodes) {
+        if (!node->isConstant())
+            continue;
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parentLevel = levels.find(node->getParentEdgeAt(i)->getParent().get());
+            if (parentLevel != levels.end())
+                level = std::max(level, parentLevel->second + 1);
+        }
+        levels[node.get()] = level;
+    }
+    return levels;
+}
+
+/**
+ * Checks whether memory of the claster edges may be replaced by another buffer between inferences.
+ * Most nodes pass the edge memory primitives to their primitives, which read the current data handles
+ * on each execution (e.g. Reorder, RNN reorders of states, TensorIterator port mappers).
+ * Split caches data pointers of its outputs on primitive creation, constant, Input and Memory nodes
+ * keep their data between inferences, so their edges keep the memory they were allocated with.
+ */
+bool canChangeDataHandles(const std::vector<MKLDNNEdgePtr>& claster) {
+    for (auto& edge : claster) {
+        for (auto& node : {edge->getParent(), edge->getChild()}) {
+            const auto type = node->getType();
+            if (node->isConstant() || type == Input || type == Split || type == MemoryInput || type == MemoryOutput)
+                return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
 template<typename NET>
 void MKLDNNGraph::ApplyUnrollPasses(NET &net) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::ApplyUnrollPasses");
@@ -329,7 +412,83 @@ void MKLDNNGraph::Replicate(const ICNNNetwork &network, const MKLDNNExtensionMan
     }
 }
 
+bool MKLDNNGraph::CreatePrototype(const ICNNNetwork &net, const MKLDNNExtensionManager::Ptr& extMgr) {
+    OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreatePrototype");
+
+    if (IsReady())
+        ForgetGraphData();
+    weightsCache = nullptr;
+
+    Replicate(net, extMgr);
+    for (auto &node : graphNodes) {
+        if (!node->canBeCloned()) {
+            ForgetGraphData();
+            return false;
+        }
+    }
+    InitTopology();
+    return true;
+}
+
+void MKLDNNGraph::CreateGraph(const MKLDNNGraph &prototype, MKLDNNWeightsSharing::Ptr &w_cache) {
+    OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
+
+    if (IsReady())
+        ForgetGraphData();
+    // disable caching if graph was created only once
+    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+
+    _name = prototype._name;
+    reuse_io_tensors = prototype.reuse_io_tensors;
+    _meanImages = prototype._meanImages;
+
+    std::unordered_map<const MKLDNNNode *, MKLDNNNodePtr> node2copy;
+    for (const auto &node : prototype.graphNodes) {
+        auto copy = node->clone(getEngine(), weightsCache);
+        if (!copy)
+            THROW_IE_EXCEPTION << "MKLDNNGraph::CreateGraph: Cannot copy node " << node->getName();
+        node2copy[node.get()] = copy;
+        graphNodes.push_back(copy);
+    }
+
+    // Descriptors of the prototype edges are already resolved, they are read directly since the
+    // prototype may be used by several threads at once
+    std::unordered_map<const MKLDNNEdge *, MKLDNNEdgePtr> edge2copy;
+    for (const auto &edge : prototype.graphEdges) {
+        MKLDNNEdgePtr copy(new MKLDNNEdge(node2copy[edge->parent.lock().get()], node2copy[edge->child.lock().get()],
+                                          edge->parent_port, edge->child_port));
+        copy->dims = edge->dims;
+        copy->inputDesc = edge->inputDesc;
+        copy->outputDesc = edge->outputDesc;
+        copy->status = edge->status;
+        edge2copy[edge.get()] = copy;
+        graphEdges.push_back(copy);
+    }
+
+    // Order of edges is kept, as nodes refer to the edges by index
+    for (const auto &node : prototype.graphNodes) {
+        auto &copy = node2copy[node.get()];
+        for (const auto &edge : node->parentEdges)
+            copy->parentEdges.push_back(edge2copy[edge.lock().get()]);
+        for (const auto &edge : node->childEdges)
+            copy->childEdges.push_back(edge2copy[edge.lock().get()]);
+    }
+
+    for (const auto &input : prototype.inputNodes)
+        inputNodes[input.first] = node2copy[input.second.get()];
+    for (const auto &output : prototype.outputNodes)
+        outputNodes.push_back(node2copy[output.get()]);
+
+    InitExecution();
+    status = Ready;
+}
+
 void MKLDNNGraph::InitGraph() {
+    InitTopology();
+    InitExecution();
+}
+
+void MKLDNNGraph::InitTopology() {
     MKLDNNGraphOptimizer optimizer;
 
     SortTopologically();
@@ -346,7 +505,9 @@ void MKLDNNGraph::InitGraph() {
 
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
+}
 
+void MKLDNNGraph::InitExecution() {
     Allocate();
 
     CreatePrimitives();
@@ -381,6 +542,12 @@ void MKLDNNGraph::InitGraph() {
 #endif
 
     ExecuteConstantNodesOnly();
+
+    InitParallelExecution();
+
+    // the block is leased again by each inference
+    if (activationArena)
+        leasedBlock.reset();
 }
 
 void MKLDNNGraph::SetOriginalLayerNames() {
@@ -410,6 +577,8 @@ void MKLDNNGraph::SetOriginalLayerNames() {
 
 void MKLDNNGraph::InitNodes() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitNodes");
+    // nodes resolve dims and descs of their edges lazily, so the edges shared with neighbours are
+    // written here and in InitDescriptors, which must stay sequential
     for (auto &node : graphNodes) {
         node->init();
     }
@@ -452,11 +621,24 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+
+    // nodes of the same level are independent and their edges don't share memory (see AllocateWithReuse)
+    std::vector<std::vector<MKLDNNNodePtr>> levels;
+    const auto constLevels = getConstantNodesLevels(graphNodes);
     for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
+        auto level = constLevels.find(graphNode.get());
+        if (level == constLevels.end())
             continue;
-        graphNode->execute(stream);
+        if (levels.size() <= static_cast<size_t>(level->second))
+            levels.resize(level->second + 1);
+        levels[level->second].push_back(graphNode);
+    }
+
+    for (auto &levelNodes : levels) {
+        parallelForNodes(levelNodes, [](const MKLDNNNodePtr& node) {
+            mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+            node->execute(stream);
+        });
     }
 }
 
@@ -499,6 +681,11 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+static inline bool isConstInternal(MKLDNNEdgePtr edge) {
+    return edge->getParent()->isConstant() && edge->getChild()->isConstant() &&
+           edge->getChild()->getType() != Output;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
     std::vector<std::vector<MKLDNNEdgePtr>> edge_clasters;
 
@@ -569,10 +756,27 @@ void MKLDNNGraph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
-    std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    // Constant nodes are executed level by level in parallel (see ExecuteConstantNodesOnly), so memory
+    // of edges between them can't be reused according to execution order. Such edges are placed into
+    // a separate workspace where live time is measured in levels. The workspace lives as long as the graph,
+    // since the memory of these edges still points into it after constant folding.
+    const auto constLevels = getConstantNodesLevels(graphNodes);
+
+    // Leased memory may be moved to another block between inferences. Views are resolved later,
+    // see InitLeasedEdges. Clasters of outputs may be bound to user buffers instead, see InitOutputBindings.
+    auto canBeLeased = [](const std::vector<MKLDNNEdgePtr> &claster) {
+        for (auto &edge : claster) {
+            if (edge->getChild()->getType() == Output)
+                return false;
+        }
+        return canChangeDataHandles(claster);
+    };
+
+    std::vector<MemorySolver::Box> boxes;
+    std::vector<MemorySolver::Box> constBoxes;
+    std::vector<MemorySolver::Box> leasedBoxes;
     for (int i = 0; i < edge_clasters.size(); i++) {
-        MemorySolver::Box &box = boxes[i];
-        box = { std::numeric_limits<int>::max(), 0, 0, i };
+        MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
@@ -599,6 +803,18 @@ void MKLDNNGraph::AllocateWithReuse() {
             box.size =  std::max(e_size, box.size);
         }
 
+        box.size = div_up(box.size, alignment);
+
+        if (std::all_of(edge_clasters[i].begin(), edge_clasters[i].end(), isConstInternal)) {
+            MemorySolver::Box constBox = { std::numeric_limits<int>::max(), 0, box.size, i };
+            for (auto &edge : edge_clasters[i]) {
+                constBox.start = std::min(constLevels.at(edge->getParent().get()), constBox.start);
+                constBox.finish = std::max(constLevels.at(edge->getChild().get()), constBox.finish);
+            }
+            constBoxes.push_back(constBox);
+            continue;
+        }
+
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
@@ -619,24 +835,88 @@ void MKLDNNGraph::AllocateWithReuse() {
             }
         }
 
-        box.size = div_up(box.size, alignment);
+        if (config.sharedActivations && box.finish != -1 && canBeLeased(edge_clasters[i])) {
+            leasedBoxes.push_back(box);
+            continue;
+        }
+
+        boxes.push_back(box);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    auto createWorkspace = [&](const std::vector<MemorySolver::Box>& workspaceBoxes,
+                               MKLDNNMemoryPtr& workspace) -> std::shared_ptr<MemorySolver> {
+        auto solver = std::make_shared<MemorySolver>(workspaceBoxes);
+        size_t total_size = static_cast<size_t>(solver->solve()) * alignment;
+
+        workspace = std::make_shared<MKLDNNMemory>(eng);
+        workspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+        return solver;
+    };
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    auto memSolver = createWorkspace(boxes, memWorkspace);
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
 
+    std::shared_ptr<MemorySolver> constMemSolver;
+    int8_t* const_workspace_ptr = nullptr;
+    memConstWorkspace.reset();
+    if (!constBoxes.empty()) {
+        constMemSolver = createWorkspace(constBoxes, memConstWorkspace);
+        const_workspace_ptr = static_cast<int8_t*>(memConstWorkspace->GetData());
+    }
+    std::unordered_set<int> constClasters;
+    for (auto &box : constBoxes)
+        constClasters.insert(static_cast<int>(box.id));
+
+    std::shared_ptr<MemorySolver> leasedMemSolver;
+    int8_t* leased_workspace_ptr = nullptr;
+    leasedEdges.clear();
+    leasedBlock.reset();
+    activationArena.reset();
+    if (!leasedBoxes.empty()) {
+        leasedMemSolver = std::make_shared<MemorySolver>(leasedBoxes);
+        leasedSize = static_cast<size_t>(leasedMemSolver->solve()) * alignment;
+        activationArena = MKLDNNActivationArena::GetInstance();
+        leasedBlock = activationArena->Acquire(leasedSize);
+        leasedData = leasedBlock->GetData();
+        leased_workspace_ptr = static_cast<int8_t*>(leasedData);
+    }
+    std::unordered_set<int> leasedClasters;
+    for (auto &box : leasedBoxes) {
+        leasedClasters.insert(static_cast<int>(box.id));
+        for (auto &edge : edge_clasters[box.id])
+            leasedEdges.push_back({edge, 0});
+    }
+
+    workspaceRegions.clear();
+    if (config.parallelBranches) {
+        for (auto &box : boxes) {
+            // memory of persistent boxes is never reused
+            if (box.finish == -1)
+                continue;
+            workspaceRegions.push_back({memSolver->getOffset(static_cast<int>(box.id)), box.size,
+                                        box.start, box.finish, edge_clasters[box.id]});
+        }
+        // the leased block is placed after the own workspace, so regions of different memory never intersect
+        const auto leasedBase = static_cast<int64_t>(memWorkspace->GetSize()) / alignment;
+        for (auto &box : leasedBoxes) {
+            workspaceRegions.push_back({leasedBase + leasedMemSolver->getOffset(static_cast<int>(box.id)), box.size,
+                                        box.start, box.finish, edge_clasters[box.id]});
+        }
+    }
+
     for (int i = 0; i < edge_clasters.size(); i++) {
+        const bool isConstClaster = constClasters.count(i) != 0;
+        const bool isLeasedClaster = leasedClasters.count(i) != 0;
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int8_t* claster_workspace_ptr = isConstClaster ? const_workspace_ptr :
+                                                isLeasedClaster ? leased_workspace_ptr : workspace_ptr;
+                int64_t offset = isConstClaster ? constMemSolver->getOffset(i) :
+                                 isLeasedClaster ? leasedMemSolver->getOffset(i) : memSolver->getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                edge->allocate(claster_workspace_ptr + offset * alignment);  // alignment in byte
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -649,6 +929,49 @@ void MKLDNNGraph::AllocateWithReuse() {
         }
         IE_ASSERT(count == 1);
     }
+
+    // Views are not resolved yet, so clasters are only collected here. See InitOutputBindings.
+    outputBindings.clear();
+    for (auto &claster : edge_clasters) {
+        for (auto &edge : claster) {
+            if (edge->getChild()->getType() == Output)
+                outputBindings[edge->getChild()->getName().substr(4)].edges = claster;
+        }
+    }
+}
+
+void MKLDNNGraph::InitOutputBindings() {
+    // The claster is bound to a user buffer by changing data handles of all its edges
+    auto canBeBound = [](const std::vector<MKLDNNEdgePtr> &claster, void *defaultPtr) {
+        int outputsNum = 0;
+        for (auto &edge : claster) {
+            if (edge->getMemory().GetPrimitive().get_data_handle() != defaultPtr)
+                return false;
+            if (edge->getChild()->getType() == Output)
+                outputsNum++;
+        }
+        // the same data is returned in several outputs, each of them gets its own copy
+        return outputsNum == 1 && canChangeDataHandles(claster);
+    };
+
+    for (auto it = outputBindings.begin(); it != outputBindings.end();) {
+        auto output = std::find_if(outputNodes.begin(), outputNodes.end(), [&](const MKLDNNNodePtr &node) {
+            return node->getName() == "out_" + it->first;
+        });
+        if (output == outputNodes.end()) {
+            it = outputBindings.erase(it);
+            continue;
+        }
+        auto outEdge = (*output)->getParentEdgeAt(0);
+        void *defaultPtr = outEdge->getMemory().GetPrimitive().get_data_handle();
+        if (!canBeBound(it->second.edges, defaultPtr)) {
+            it = outputBindings.erase(it);
+            continue;
+        }
+        it->second.desc = outEdge->getDesc();
+        it->second.defaultPtr = defaultPtr;
+        ++it;
+    }
 }
 
 void MKLDNNGraph::Allocate() {
@@ -667,14 +990,57 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    InitOutputBindings();
+    InitLeasedEdges();
+}
+
+void MKLDNNGraph::InitLeasedEdges() {
+    if (leasedEdges.empty())
+        return;
+
+    // Views may point to any place of the block, so offsets are taken from the resolved memory
+    auto* data = static_cast<int8_t*>(leasedData);
+    for (auto &leased : leasedEdges) {
+        auto* ptr = static_cast<int8_t*>(leased.edge->getMemory().GetPrimitive().get_data_handle());
+        if (ptr < data || ptr >= data + leasedSize) {
+            // the graph keeps the block, so the edges are never moved
+            activationArena.reset();
+            leasedEdges.clear();
+            return;
+        }
+        leased.offset = static_cast<size_t>(ptr - data);
+    }
+}
+
+MKLDNNGraph::ActivationsLease::ActivationsLease(MKLDNNGraph &graph) : graph(graph) {
+    if (!graph.activationArena)
+        return;
+
+    graph.leasedBlock = graph.activationArena->Acquire(graph.leasedSize, graph.leasedData);
+    auto* data = static_cast<int8_t*>(graph.leasedBlock->GetData());
+    if (data == graph.leasedData)
+        return;
+    for (auto &leased : graph.leasedEdges)
+        leased.edge->getMemory().GetPrimitivePtr()->set_data_handle(data + leased.offset);
+    graph.leasedData = data;
+}
+
+MKLDNNGraph::ActivationsLease::~ActivationsLease() {
+    if (graph.activationArena)
+        graph.leasedBlock.reset();
 }
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // dims, descs and memory of all edges are resolved by allocation, nodes only read them here;
+    // constant flag is evaluated lazily looking at neighbours, so it is resolved before parallel section
+    for (auto &node : graphNodes)
+        node->isConstant();
+    parallelForNodes(graphNodes, [](const MKLDNNNodePtr& node) {
         OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
-    }
+    });
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -765,6 +1131,13 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    ActivationsLease lease(*this);
+
+    if (!execGraph.empty()) {
+        InferParallel(batch);
+        return;
+    }
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (int i = 0; i < graphNodes.size(); i++) {
         if (IsCancellationRequested()) {
@@ -790,6 +1163,216 @@ void MKLDNNGraph::Infer(int batch) {
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::InitParallelExecution() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::InitParallelExecution");
+
+    execGraph.clear();
+    execGraphRoots.clear();
+    execGraphPending.reset();
+    std::vector<WorkspaceRegion> regions;
+    regions.swap(workspaceRegions);
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && !defined(BLOB_DUMP_PATH)
+    if (!config.parallelBranches)
+        return;
+
+    // memory layers pass data between nodes which are not connected by edges
+    for (auto &node : graphNodes) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            return;
+    }
+
+    std::unordered_map<MKLDNNNode*, size_t> indices;
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        indices[node.get()] = execGraph.size();
+        execGraph.push_back({node, mkldnn::stream(stream::kind::eager), {}, 0});
+    }
+
+    std::vector<std::unordered_set<size_t>> successors(execGraph.size());
+    auto addDependency = [&](MKLDNNNode* from, MKLDNNNode* to) {
+        auto fromIndex = indices.find(from);
+        auto toIndex = indices.find(to);
+        if (fromIndex == indices.end() || toIndex == indices.end() || fromIndex->second == toIndex->second)
+            return;
+        successors[fromIndex->second].insert(toIndex->second);
+    };
+
+    for (auto &node : graphNodes) {
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            addDependency(node->getParentEdgeAt(i)->getParent().get(), node.get());
+    }
+
+    // Memory solver places clasters at the same memory only if their live times don't intersect in
+    // the sequential order. So all nodes using the earlier claster must be finished before any node
+    // using the later one starts, otherwise a parallel branch could overwrite data which is still in use.
+    std::vector<std::unordered_set<MKLDNNNode*>> regionNodes(regions.size());
+    for (size_t i = 0; i < regions.size(); i++) {
+        for (auto &edge : regions[i].edges) {
+            regionNodes[i].insert(edge->getParent().get());
+            regionNodes[i].insert(edge->getChild().get());
+        }
+    }
+    for (size_t i = 0; i < regions.size(); i++) {
+        for (size_t j = 0; j < regions.size(); j++) {
+            const auto &first = regions[i], &second = regions[j];
+            if (first.finish >= second.start)
+                continue;
+            if (first.offset >= second.offset + second.size || second.offset >= first.offset + first.size)
+                continue;
+            for (auto from : regionNodes[i]) {
+                for (auto to : regionNodes[j])
+                    addDependency(from, to);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < execGraph.size(); i++) {
+        execGraph[i].successors.assign(successors[i].begin(), successors[i].end());
+        std::sort(execGraph[i].successors.begin(), execGraph[i].successors.end());
+        for (auto successor : execGraph[i].successors)
+            execGraph[successor].dependencies++;
+    }
+    for (size_t i = 0; i < execGraph.size(); i++) {
+        if (execGraph[i].dependencies == 0)
+            execGraphRoots.push_back(i);
+    }
+    execGraphPending.reset(new std::atomic<int>[execGraph.size()]);
+#endif
+}
+
+void MKLDNNGraph::InferParallel(int batch) {
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+    if (batch > 0) {
+        for (auto &node : graphNodes)
+            node->setDynamicBatchLim(batch);
+    }
+
+    for (size_t i = 0; i < execGraph.size(); i++)
+        execGraphPending[i] = execGraph[i].dependencies;
+
+    // Tasks are executed in the arena of the calling stream. Each task runs a node and then continues
+    // with its first successor which became ready, other ready successors are spawned as new tasks.
+    std::atomic<bool> cancelled(false);
+    tbb::task_group group;
+    std::function<void(size_t)> run = [&](size_t index) {
+        while (index < execGraph.size()) {
+            if (IsCancellationRequested()) {
+                cancelled = true;
+                return;
+            }
+
+            auto &execNode = execGraph[index];
+            {
+                PERF(execNode.node);
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, execNode.node->profiling.execute);
+                // see parallelForNodes
+                tbb::this_task_arena::isolate([&] {
+                    execNode.node->execute(execNode.stream);
+                });
+            }
+
+            index = execGraph.size();
+            for (auto successor : execNode.successors) {
+                if (--execGraphPending[successor] != 0)
+                    continue;
+                if (index == execGraph.size())
+                    index = successor;
+                else
+                    group.run([&run, successor] { run(successor); });
+            }
+        }
+    };
+    for (auto root : execGraphRoots)
+        group.run([&run, root] { run(root); });
+    group.wait();
+
+    if (cancelled) {
+        ResetCancellationRequest();
+        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << InferenceEngine::INFER_CANCELLED;
+    }
+#else
+    THROW_IE_EXCEPTION << "Parallel execution of graph branches requires TBB threading";
+#endif
+}
+
+bool MKLDNNGraph::CanChangeInputPtr(const MKLDNNNodePtr &input) {
+    // Input cannot be in-place with other primitives
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto& child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+#endif
+        // Cannot be in-place before split because split is using different ptrs without offsets
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        if (split)
+            return false;
+#endif
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    input->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool MKLDNNGraph::CanChangeOutputPtr(const MKLDNNNodePtr &output) {
+    void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace())
+            return false;
+
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+bool MKLDNNGraph::CanBindOutputPtr(const std::string &name, const TensorDesc &desc) const {
+    auto binding = outputBindings.find(name);
+    if (binding == outputBindings.end())
+        return false;
+
+    // the producer writes data in its own layout, so a buffer must have exactly the same one
+    const auto &outDesc = binding->second.desc;
+    return desc.getPrecision() == outDesc.getPrecision() && desc.getDims() == outDesc.getDims() &&
+           desc.getBlockingDesc() == outDesc.getBlockingDesc();
+}
+
+void MKLDNNGraph::BindOutputPtr(const std::string &name, void *ptr) {
+    auto binding = outputBindings.find(name);
+    if (binding == outputBindings.end()) {
+        if (ptr == nullptr)
+            return;
+        THROW_IE_EXCEPTION << "Output " << name << " cannot be bound to an external buffer";
+    }
+
+    void *newPtr = ptr ? ptr : binding->second.defaultPtr;
+    for (auto &edge : binding->second.edges) {
+        auto &memory = *edge->getMemory().GetPrimitivePtr();
+        if (memory.get_data_handle() != newPtr)
+            memory.set_data_handle(newPtr);
+    }
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -1093,7 +1676,7 @@ MKLDNNNodePtr MKLDNNGraph::InsertReorder(MKLDNNEdgePtr edge, std::string layerNa
     CNNLayerPtr layer(new CNNLayer({layerName,
                                     "Reorder",
                                     inDesc.getPrecision()}));
-    MKLDNNNodePtr newReorder(new MKLDNNReorderNode(layer, getEngine(), weightsCache));
+    MKLDNNNodePtr newReorder(new MKLDNNNodeImpl<MKLDNNReorderNode>(layer, getEngine(), weightsCache));
     auto *reorderPtr = dynamic_cast<MKLDNNReorderNode *>(newReorder.get());
     if (reorderPtr == nullptr) {
         THROW_IE_EXCEPTION << "MKLDNNGraph::InsertReorder: Cannot cast to MKLDNNReorderNode";
@@ -11,6 +11,7 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_activation_arena.hpp"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
@@ -56,6 +57,19 @@ public:
                      const MKLDNNExtensionManager::Ptr& extMgr,
                      MKLDNNWeightsSharing::Ptr &w_cache);
 
+    /**
+     * @brief Replicates the network and selects primitive descriptors of the nodes, but does not allocate memory
+     * and create primitives. The result may be used only as a prototype for the CreateGraph overload below.
+     * @return false if some nodes of the network cannot be copied, the graph stays empty in this case
+     */
+    bool CreatePrototype(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
+
+    /**
+     * @brief Creates the graph as a copy of the prototype topology, so only memory and primitives are created.
+     * The prototype must outlive the graph, since nodes may refer to the data of the nodes they are copied from.
+     */
+    void CreateGraph(const MKLDNNGraph &prototype, MKLDNNWeightsSharing::Ptr &w_cache);
+
     bool hasMeanImageFor(const std::string& name) {
         return _meanImages.find(name) != _meanImages.end();
     }
@@ -126,6 +140,30 @@ public:
 
     void ResetInferCount() { infer_count = 0; }
 
+    /**
+     * @brief Checks whether memory of all child edges of the input node can be replaced with
+     * an external buffer, i.e. nodes of the graph do not write to it or use it as a view
+     */
+    static bool CanChangeInputPtr(const MKLDNNNodePtr &input);
+
+    /**
+     * @brief Checks whether memory of the parent edge of the output node can be replaced with
+     * an external buffer, i.e. it is written by a single node and is not a view on other memory
+     */
+    static bool CanChangeOutputPtr(const MKLDNNNodePtr &output);
+
+    /**
+     * @brief Checks whether the producer of the output can write directly into an external buffer
+     * described by desc instead of the memory allocated by the graph
+     */
+    bool CanBindOutputPtr(const std::string &name, const InferenceEngine::TensorDesc &desc) const;
+
+    /**
+     * @brief Replaces memory of all edges sharing data with the output by an external buffer,
+     * nullptr restores the memory allocated by the graph. Output must be checked by CanBindOutputPtr.
+     */
+    void BindOutputPtr(const std::string &name, void *ptr);
+
     void SortTopologically();
 
 protected:
@@ -148,6 +186,14 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        workspaceRegions.clear();
+        outputBindings.clear();
+        leasedEdges.clear();
+        leasedBlock.reset();
+        activationArena.reset();
+        execGraph.clear();
+        execGraphRoots.clear();
+        execGraphPending.reset();
     }
     Status status;
     Config config;
@@ -159,6 +205,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MKLDNNMemoryPtr memConstWorkspace;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -168,19 +215,77 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    // Part of the workspace used by one edges claster. Kept only to build execGraph.
+    struct WorkspaceRegion {
+        int64_t offset;
+        int64_t size;
+        int start;
+        int finish;
+        std::vector<MKLDNNEdgePtr> edges;
+    };
+    std::vector<WorkspaceRegion> workspaceRegions;
+
+    // Edges which are views on memory of a network output, including the edges of in-place producers.
+    // Only outputs whose memory may be replaced by a user buffer are kept.
+    struct OutputBinding {
+        std::vector<MKLDNNEdgePtr> edges;
+        InferenceEngine::TensorDesc desc;
+        void *defaultPtr = nullptr;
+    };
+    std::map<std::string, OutputBinding> outputBindings;
+
+    // Clasters of edges which are used only inside of an inference are placed into a block leased from
+    // the process-wide arena for the time of Infer (see KEY_CPU_SHARED_ACTIVATIONS). If the arena returns
+    // another block, data handles of the edges are moved to it keeping their offsets.
+    struct LeasedEdge {
+        MKLDNNEdgePtr edge;
+        size_t offset;
+    };
+    std::vector<LeasedEdge> leasedEdges;
+    size_t leasedSize = 0;
+    void *leasedData = nullptr;
+    std::shared_ptr<MKLDNNActivationArena::Block> leasedBlock;
+    // empty if the block is not leased per inference, then leasedBlock is kept by the graph
+    std::shared_ptr<MKLDNNActivationArena> activationArena;
+
+    // Leases the block for the time of one inference
+    struct ActivationsLease {
+        explicit ActivationsLease(MKLDNNGraph &graph);
+        ~ActivationsLease();
+        MKLDNNGraph &graph;
+    };
+
+    // Dependency graph of non constant nodes used for parallel execution of independent branches.
+    // It is empty if nodes are executed one by one in graphNodes order.
+    struct ExecNode {
+        MKLDNNNodePtr node;
+        mkldnn::stream stream;
+        std::vector<size_t> successors;
+        int dependencies;
+    };
+    std::vector<ExecNode> execGraph;
+    std::vector<size_t> execGraphRoots;
+    std::unique_ptr<std::atomic<int>[]> execGraphPending;
+
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const InferenceEngine::TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
+    void InitTopology();
+    void InitExecution();
     void InitNodes();
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void InitOutputBindings();
+    void InitLeasedEdges();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void InitParallelExecution();
+    void InferParallel(int batch);
     void SetOriginalLayerNames();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
@@ -8,8 +8,6 @@
 #include <string>
 #include <map>
 #include <blob_factory.hpp>
-#include <nodes/mkldnn_concat_node.h>
-#include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
@@ -224,7 +222,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _outputs[name] = make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        if (!graph->getProperty().batchLimit && graph->CanBindOutputPtr(name, desc)) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -321,8 +319,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (!graph->getProperty().batchLimit && graph->CanBindOutputPtr(name, data->getTensorDesc())) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -341,72 +338,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
         if (input != graph->inputNodes.end()) {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-#endif
-                // Cannot be in-place before split because split is using different ptrs without offsets
-#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-#endif
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
+            bool canBeInPlace = MKLDNNGraph::CanChangeInputPtr(input->second);
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
-            continue;
-        }
-        THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
+        if (_networkOutputs.find(it.first) == _networkOutputs.end())
+            THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
+    }
+
+    // The graph is shared by all requests of a stream, so outputs bound by other requests are restored
+    for (auto& it : _networkOutputs) {
+        auto ptr = externalPtr.find(it.first);
+        graph->BindOutputPtr(it.first, ptr != externalPtr.end() ? ptr->second : nullptr);
     }
 }
 
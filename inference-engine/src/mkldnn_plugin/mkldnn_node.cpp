@@ -218,6 +218,42 @@ MKLDNNNode::MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::
     }
 }
 
+MKLDNNNodePtr MKLDNNNode::clone(const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache) const {
+    MKLDNNNodePtr node(copy());
+    if (!node)
+        return nullptr;
+
+    node->engine = eng;
+    node->weightCache = w_cache;
+    node->parentEdges.clear();
+    node->childEdges.clear();
+    for (auto &fusedNode : node->fusedWith) {
+        fusedNode = fusedNode->clone(eng, w_cache);
+        if (!fusedNode)
+            return nullptr;
+    }
+    for (auto &mergedNode : node->mergedWith) {
+        mergedNode = mergedNode->clone(eng, w_cache);
+        if (!mergedNode)
+            return nullptr;
+    }
+    return node;
+}
+
+bool MKLDNNNode::canBeCloned() const {
+    if (!isCopyable())
+        return false;
+    for (const auto &fusedNode : fusedWith) {
+        if (!fusedNode->canBeCloned())
+            return false;
+    }
+    for (const auto &mergedNode : mergedWith) {
+        if (!mergedNode->canBeCloned())
+            return false;
+    }
+    return true;
+}
+
 void MKLDNNNode::addEdge(const MKLDNNEdgeWeakPtr& edge) {
     auto edgePtr = edge.lock();
     if (!edgePtr)
@@ -6,6 +6,7 @@
 
 #include <ie_api.h>
 #include <memory>
+#include <type_traits>
 #include <vector>
 #include <string>
 #include <cassert>
@@ -257,7 +258,7 @@ private:
     std::vector<mkldnn::memory::format> outputLayouts;
 };
 
-class MKLDNNNode : public InferenceEngine::details::no_copy {
+class MKLDNNNode {
 public:
     template<typename T, int N>
     struct Tag {};
@@ -295,7 +296,17 @@ public:
     class NodesFactory;
     static NodesFactory & factory();
 
-    ~MKLDNNNode() override = default;
+    virtual ~MKLDNNNode() = default;
+
+    /**
+     * @brief Creates a copy of the node with the same descriptors and selected primitive descriptor, but without
+     * edges, memory and primitives. The copy is used to build a graph from the prototype one.
+     * @param eng engine of the graph the copy is placed to
+     * @param w_cache weights cache of the graph the copy is placed to
+     * @return pointer to the copy or nullptr if the node or one of the nodes fused into it cannot be copied
+     */
+    MKLDNNNodePtr clone(const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache) const;
+    bool canBeCloned() const;
 
     void addEdge(const MKLDNNEdgeWeakPtr& edge);
     void removeEdge(const MKLDNNEdgeWeakPtr& edge);
@@ -550,6 +561,15 @@ protected:
     std::string originalLayers;  // contains names of the original layers separated by comma
 
     MKLDNNNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache);
+    MKLDNNNode(const MKLDNNNode& node) = default;
+    MKLDNNNode& operator=(const MKLDNNNode& node) = delete;
+
+    virtual bool isCopyable() const {
+        return false;
+    }
+    virtual MKLDNNNode* copy() const {
+        return nullptr;
+    }
 
     int selectedPrimitiveDescriptorIndex = -1;
     bool permanent = false;
@@ -639,12 +659,37 @@ public:
                        const MKLDNNExtensionManager::Ptr& extMgr, MKLDNNWeightsSharing::Ptr &w_cache);
 };
 
+/**
+ * @brief Tells whether nodes of the type may be copied to another graph. Types which are copy constructible
+ * but keep references to the graph or register themselves somewhere should specialize it as false.
+ */
+template<typename MKLDNNNodeType>
+struct MKLDNNNodeCopyable : std::is_copy_constructible<MKLDNNNodeType> {};
+
 template<typename MKLDNNNodeType>
 struct MKLDNNNodeImpl : public MKLDNNNodeType {
     MKLDNNNodeImpl(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNodeType(layer, eng, cache) {
         MKLDNNNodeType::perfCounters().template buildClassCounters<MKLDNNNodeType>(NameFromType(MKLDNNNodeType::getType()));
     }
+
+protected:
+    bool isCopyable() const override {
+        return MKLDNNNodeCopyable<MKLDNNNodeType>::value;
+    }
+
+    MKLDNNNode* copy() const override {
+        return copy(MKLDNNNodeCopyable<MKLDNNNodeType>());
+    }
+
+private:
+    MKLDNNNode* copy(std::true_type) const {
+        return new MKLDNNNodeImpl(*this);
+    }
+
+    MKLDNNNode* copy(std::false_type) const {
+        return nullptr;
+    }
 };
 
 #define REG_MKLDNN_CONCAT3_(X, Y, Z) X ## Y ## Z
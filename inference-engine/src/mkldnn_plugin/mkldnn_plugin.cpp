@@ -7,6 +7,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "xml_parse_utils.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
@@ -14,12 +15,14 @@
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
+#include <cstring>
 #include <ie_system_conf.h>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
 #include <ie_ngraph_utils.hpp>
+#include <pugixml.hpp>
 
 #include <legacy/convert_function_to_cnn_network.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_opset1_to_legacy.hpp>
@@ -62,7 +65,9 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
 #include <ngraph/op/util/op_types.hpp>
+#include <ngraph/graph_util.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/runtime/parallel.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -98,6 +103,8 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
     auto nGraphFunc = clonedNetwork->getFunction();
     // Disable shape inference (WA for generic operations)
     ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
+    // Constant folding uses the threads given by CPU_THREADS_NUM (0 means all of them)
+    ngraph::runtime::ParallelThreadsLimit threadsLimit(static_cast<size_t>(conf.streamExecutorConfig._threads));
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
@@ -325,7 +332,97 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    // keep untransformed copy for ExecutableNetwork::Export, so the network is exported as it was loaded
+    // even if the user changes or releases it; constants data is shared, not copied
+    std::shared_ptr<const ngraph::Function> originalFunction;
+    if (network.getFunction()) {
+        originalFunction = ngraph::clone_function(*network.getFunction());
+    }
+    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing, originalFunction);
+}
+
+InferenceEngine::ExecutableNetwork Engine::ImportNetworkImpl(std::istream& networkModel,
+                                                             const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    std::string headerXmlStr;
+    std::getline(networkModel, headerXmlStr);
+
+    pugi::xml_document headerXmlDoc;
+    pugi::xml_parse_result res = headerXmlDoc.load_string(headerXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+
+    pugi::xml_node cpuNode = headerXmlDoc.document_element();
+    if (GetUIntAttr(cpuNode, "version") != 1) {
+        THROW_IE_EXCEPTION << "Unsupported version of exported CPU network: " << GetStrAttr(cpuNode, "version");
+    }
+
+    std::map<std::string, std::string> importedConfigs;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+            configNode = configNode.next_sibling("config")) {
+        importedConfigs.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& cfg : config) {
+        importedConfigs[cfg.first] = cfg.second;
+    }
+
+    auto readSection = [&networkModel] {
+        std::uint64_t dataSize = 0;
+        networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+        std::string data(static_cast<std::size_t>(dataSize), '\0');
+        if (0 != dataSize) {
+            networkModel.read(&data[0], dataSize);
+        }
+        if (!networkModel.good()) {
+            THROW_IE_EXCEPTION << "Error reading exported CPU network";
+        }
+        return data;
+    };
+
+    std::string xmlString = readSection();
+    std::string binString = readSection();
+
+    Blob::Ptr dataBlob;
+    if (!binString.empty()) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {binString.size()}, Layout::C));
+        dataBlob->allocate();
+        std::memcpy(dataBlob->buffer(), binString.data(), binString.size());
+    }
+
+    auto cnnnetwork = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputs = cnnnetwork.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network has no input " << GetStrAttr(inputNode, "name");
+        }
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetUIntAttr(inputNode, "layout")));
+    }
+
+    auto outputs = cnnnetwork.getOutputsInfo();
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network has no output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetUIntAttr(outputNode, "layout")));
+    }
+
+    return LoadNetwork(cnnnetwork, importedConfigs);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -5,11 +5,61 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <transformations/utils/data_hash.hpp>
+#include <chrono>
 #include <memory>
 
 namespace MKLDNNPlugin {
 
-const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    return ngraph::DataHash::hash(data, size);
+}
+
+const SimpleDataHash MKLDNNWeightsSharing::simpleHash;
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& name_hash,
+                                                   std::function<MKLDNNMemoryPtr(void)> create) {
+    while (true) {
+        std::promise<std::weak_ptr<MKLDNNMemory>> promise;
+        std::shared_future<std::weak_ptr<MKLDNNMemory>> future;
+        bool creator = false;
+        {
+            std::lock_guard<std::mutex> lock(guard);
+            auto found = sharedWeights.find(name_hash);
+            // an object is being created or was created before, the latter may be already released
+            if (found != sharedWeights.end() &&
+                (found->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready ||
+                 !found->second.get().expired())) {
+                future = found->second;
+            } else {
+                future = promise.get_future().share();
+                sharedWeights[name_hash] = future;
+                creator = true;
+            }
+        }
+
+        if (!creator) {
+            // released by all owners between creation and this call, try again
+            if (auto ptr = future.get().lock())
+                return ptr;
+            continue;
+        }
+
+        MKLDNNMemoryPtr ptr;
+        try {
+            ptr = create();
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(guard);
+                sharedWeights.erase(name_hash);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+        promise.set_value(ptr);
+        return ptr;
+    }
+}
 
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
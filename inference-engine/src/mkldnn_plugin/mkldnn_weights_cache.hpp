@@ -8,6 +8,7 @@
 
 #include <unordered_map>
 #include <functional>
+#include <future>
 #include <string>
 #include <memory>
 #include <mutex>
@@ -23,55 +24,33 @@ namespace MKLDNNPlugin {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
+    /**
+     * Computes 64-bit non-cryptographic xxHash64 of data with ngraph::DataHash.
+     * Data is processed by 8-byte words in 4 independent lanes, so the loop is not limited
+     * by a byte-wise table lookup dependency chain as CRC is.
+     */
+    uint64_t hash(const unsigned char* data, size_t size) const;
 };
 
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
- * Is a thread safe
+ * Is a thread safe. Objects are created outside of the lock, so different objects are created
+ * concurrently, while concurrent requests of the same object wait for the single creation.
  */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
-                             std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
+                             std::function<MKLDNNMemoryPtr(void)> create);
 
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
-            sharedWeights[name_hash] = ptr;
-        }
-        return ptr;
-    }
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    static const SimpleDataHash& GetHashFunc () { return simpleHash; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+    std::unordered_map<std::string, std::shared_future<std::weak_ptr<MKLDNNMemory>>> sharedWeights;
     std::mutex guard;
-    static const SimpleDataHash simpleCRC;
+    static const SimpleDataHash simpleHash;
 };
 
 /**
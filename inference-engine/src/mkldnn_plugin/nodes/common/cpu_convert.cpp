@@ -3,9 +3,11 @@
 //
 
 #include "cpu_convert.h"
+#include "cpu_convert_imp.hpp"
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
 #include <mkldnn_selective_build.h>
+#include <algorithm>
 #include <type_traits>
 #include <tuple>
 #include <ie_parallel.hpp>
@@ -22,8 +24,13 @@ void convert(const void *srcPtr, void *dstPtr, const size_t size) {
         const srcType *srcData = reinterpret_cast<const srcType *>(srcPtr);
         dstType *dstData = reinterpret_cast<dstType *>(dstPtr);
 
-        parallel_for(size, [&](size_t i) {
-            dstData[i] = static_cast<dstType>(srcData[i]);
+        // blocks of elements keep the threading overhead low for small tensors
+        constexpr size_t block = 16 * 1024;
+        parallel_for((size + block - 1) / block, [&](size_t b) {
+            const size_t end = std::min(size, (b + 1) * block);
+            for (size_t i = b * block; i < end; i++) {
+                dstData[i] = static_cast<dstType>(srcData[i]);
+            }
         });
     }
 }
@@ -71,6 +78,10 @@ void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision d
         return;
     }
 
+    // the common pairs are converted by the kernels compiled for the instruction set of the machine
+    if (XARCH::cpu_convert_vec(srcPtr, dstPtr, srcPrc, dstPrc, size))
+        return;
+
     ConvertContext ctx = { srcPtr, dstPtr, size, false };
 
     OV_SWITCH(MKLDNNPlugin, ConvertPrecision, ctx, std::tie(srcPrc, dstPrc),
@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_convert_imp.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <ie_parallel.hpp>
+#include <mkldnn_selective_build.h>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace XARCH {
+namespace {
+
+// bfloat16 is kept as raw bits, so the conversion loops have no calls inside and are vectorized by the compiler
+struct bf16_bits {
+    uint16_t value;
+};
+
+inline float bit_cast_to_float(uint32_t value) {
+    float result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+inline uint32_t bit_cast_to_uint(float value) {
+    uint32_t result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+template <typename dst_t, typename src_t>
+struct Converter {
+    static inline dst_t convert(src_t value) {
+        return static_cast<dst_t>(value);
+    }
+};
+
+template <typename dst_t>
+struct Converter<dst_t, bf16_bits> {
+    static inline dst_t convert(bf16_bits value) {
+        return static_cast<dst_t>(bit_cast_to_float(static_cast<uint32_t>(value.value) << 16));
+    }
+};
+
+// rounding is the same as in bfloat16_t, so the results do not depend on the kernel used
+template <typename src_t>
+struct Converter<bf16_bits, src_t> {
+    static inline bf16_bits convert(src_t value) {
+        const uint32_t bits = bit_cast_to_uint(static_cast<float>(value));
+        return {static_cast<uint16_t>((bits + ((bits & 0x00010000) >> 1)) >> 16)};
+    }
+};
+
+// the pointers are passed by value, so the stores to the 8-bit destinations cannot alias them and the loop is vectorized
+template <typename src_t, typename dst_t>
+void convert_block(const src_t *srcData, dst_t *dstData, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dstData[i] = Converter<dst_t, src_t>::convert(srcData[i]);
+    }
+}
+
+template <typename src_t, typename dst_t>
+void convert(const void *srcPtr, void *dstPtr, const size_t size) {
+    const src_t *srcData = reinterpret_cast<const src_t *>(srcPtr);
+    dst_t *dstData = reinterpret_cast<dst_t *>(dstPtr);
+    // a block is converted by one thread, so small tensors are converted without waking up the others
+    constexpr size_t block = 16 * 1024;
+    const size_t blocks = (size + block - 1) / block;
+    if (blocks == 1) {
+        convert_block(srcData, dstData, size);
+    } else {
+        parallel_for(blocks, [&](size_t b) {
+            const size_t start = b * block;
+            convert_block(srcData + start, dstData + start, std::min(block, size - start));
+        });
+    }
+}
+
+template <Precision::ePrecision p>
+struct PrecisionInfo {
+    using value_type = typename PrecisionTrait<p>::value_type;
+};
+
+template <>
+struct PrecisionInfo<Precision::BF16> {
+    using value_type = bf16_bits;
+};
+
+struct ConvertContext {
+    const void *srcPtr;
+    void *dstPtr;
+    size_t size;
+    bool converted;
+};
+
+template<typename T>
+struct ConvertPrecisionVec {
+    using src_t = typename std::tuple_element<0, T>::type;
+    using dst_t = typename std::tuple_element<1, T>::type;
+
+    void operator()(ConvertContext & ctx) {
+        convert<src_t, dst_t>(ctx.srcPtr, ctx.dstPtr, ctx.size);
+        ctx.converted = true;
+    }
+};
+
+}   // namespace
+
+#define MKLDNN_CVT(ST, DT) OV_CASE2(Precision::ST, Precision::DT, PrecisionInfo<Precision::ST>::value_type, PrecisionInfo<Precision::DT>::value_type)
+
+bool cpu_convert_vec(const void *srcPtr, void *dstPtr, Precision::ePrecision srcPrc, Precision::ePrecision dstPrc, size_t size) {
+    ConvertContext ctx = { srcPtr, dstPtr, size, false };
+
+    OV_SWITCH(MKLDNNPlugin, ConvertPrecisionVec, ctx, std::tie(srcPrc, dstPrc),
+    MKLDNN_CVT(U8, I8),    MKLDNN_CVT(U8, U16),    MKLDNN_CVT(U8, I16),
+    MKLDNN_CVT(U8, I32),   MKLDNN_CVT(U8, FP32),   MKLDNN_CVT(U8, BF16),
+    MKLDNN_CVT(I8, U8),    MKLDNN_CVT(I8, U16),    MKLDNN_CVT(I8, I16),
+    MKLDNN_CVT(I8, I32),   MKLDNN_CVT(I8, FP32),   MKLDNN_CVT(I8, BF16),
+    MKLDNN_CVT(U16, U8),   MKLDNN_CVT(U16, I8),    MKLDNN_CVT(U16, I16),
+    MKLDNN_CVT(U16, I32),  MKLDNN_CVT(U16, FP32),  MKLDNN_CVT(U16, BF16),
+    MKLDNN_CVT(I16, U8),   MKLDNN_CVT(I16, I8),    MKLDNN_CVT(I16, U16),
+    MKLDNN_CVT(I16, I32),  MKLDNN_CVT(I16, FP32),  MKLDNN_CVT(I16, BF16),
+    MKLDNN_CVT(I32, U8),   MKLDNN_CVT(I32, I8),    MKLDNN_CVT(I32, U16),
+    MKLDNN_CVT(I32, I16),  MKLDNN_CVT(I32, FP32),  MKLDNN_CVT(I32, BF16),
+    MKLDNN_CVT(FP32, U8),  MKLDNN_CVT(FP32, I8),   MKLDNN_CVT(FP32, U16),
+    MKLDNN_CVT(FP32, I16), MKLDNN_CVT(FP32, I32),  MKLDNN_CVT(FP32, BF16),
+    MKLDNN_CVT(BF16, U8),  MKLDNN_CVT(BF16, I8),   MKLDNN_CVT(BF16, U16),
+    MKLDNN_CVT(BF16, I16), MKLDNN_CVT(BF16, I32),  MKLDNN_CVT(BF16, FP32));
+
+    return ctx.converted;
+}
+
+#undef MKLDNN_CVT
+
+}  // namespace XARCH
+}  // namespace MKLDNNPlugin
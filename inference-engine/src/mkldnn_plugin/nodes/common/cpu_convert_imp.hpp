@@ -0,0 +1,18 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <ie_precision.hpp>
+
+namespace MKLDNNPlugin {
+namespace XARCH {
+
+// Converts the buffer if the pair of precisions has a vectorized kernel, returns false otherwise.
+bool cpu_convert_vec(const void *srcPtr, void *dstPtr, InferenceEngine::Precision::ePrecision srcPrc,
+                     InferenceEngine::Precision::ePrecision dstPrc, size_t size);
+
+}  // namespace XARCH
+}  // namespace MKLDNNPlugin
@@ -19,7 +19,8 @@ namespace Cpu {
 template <typename T>
 static bool SortScorePairDescend(const std::pair<float, T>& pair1,
                                  const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
+    // ties are ordered by the second element to make results independent of the sorting algorithm
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
 class DetectionOutputImpl: public ExtLayerBase {
@@ -178,61 +179,59 @@ public:
             }
         }
 
-        if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
-                    }
+        // Confidences are transposed by blocks of priors, so both reads and writes are sequential
+        const int prior_blocks = (_num_priors + reorder_block - 1) / reorder_block;
+        parallel_for2d(N, prior_blocks, [&](int n, int pb) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes;
+            const int p_end = (std::min)(_num_priors, (pb + 1) * reorder_block);
+            for (int c = 0; c < _num_classes; ++c) {
+                float *pdst = preordered + c*_num_priors;
+                for (int p = pb * reorder_block; p < p_end; ++p) {
+                    pdst[p] = pconf[p*_num_classes + c];
                 }
             }
-        } else {
-            for (int n = 0; n < N; ++n) {
-                for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
-                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
+            if (with_add_box_pred) {
+                const float *parm_conf = arm_conf_data + n*_num_priors*2;
+                for (int p = pb * reorder_block; p < p_end; ++p) {
+                    if (parm_conf[p * 2 + 1] < _objectness_score) {
+                        for (int c = 0; c < _num_classes; ++c) {
+                            preordered[c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
+                        }
                     }
                 }
             }
-        }
+        });
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style, classes of all images are processed independently
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            for (int n = 0; n < N; ++n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -241,13 +240,17 @@ public:
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
             }
+        }
 
+        parallel_for(N, [&](int n) {
+            int detections_total = 0;
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
                 std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                conf_index_class_map.reserve(detections_total);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -261,8 +264,11 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                // only keep_top_k detections have to be ordered
+                auto keep_end = conf_index_class_map.begin() + _keep_top_k;
+                std::nth_element(conf_index_class_map.begin(), keep_end, conf_index_class_map.end(),
+                                 SortScorePairDescend<std::pair<int, int>>);
+                std::sort(conf_index_class_map.begin(), keep_end, SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -276,7 +282,7 @@ public:
                     detections_data[n*_num_classes + label]++;
                 }
             }
-        }
+        });
 
         const int num_results = outputs[0]->getTensorDesc().getDims()[2];
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
@@ -378,6 +384,7 @@ private:
 
     int _num = 0;
     int _num_loc_classes = 0;
+    const int reorder_block = 64;
     int _num_priors = 0;
     bool _priors_batches = false;
 
@@ -405,53 +412,114 @@ private:
     InferenceEngine::Blob::Ptr _num_priors_actual;
 };
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
-        return idx1 < idx2;
+/**
+ * Writes indices of elements greater than the threshold (greater or equal if inclusive) to indices
+ * @return Number of written indices
+ */
+template <bool inclusive>
+static int filterByThreshold(const float *conf_data, int size, float threshold, int *indices) {
+    const int block = 16;
+    int count = 0;
+    int i = 0;
+    for (; i + block <= size; i += block) {
+        // Comparison of a block is vectorized by compiler, blocks without candidates are skipped at once
+        unsigned mask = 0;
+        for (int j = 0; j < block; ++j) {
+            mask |= static_cast<unsigned>(inclusive ? conf_data[i + j] >= threshold : conf_data[i + j] > threshold) << j;
+        }
+        if (mask == 0) {
+            continue;
+        }
+        // branchless compaction
+        for (int j = 0; j < block; ++j) {
+            indices[count] = i + j;
+            count += (mask >> j) & 1;
+        }
     }
+    for (; i < size; ++i) {
+        if (inclusive ? conf_data[i] >= threshold : conf_data[i] > threshold) {
+            indices[count++] = i;
+        }
+    }
+    return count;
+}
 
-    const float* _conf_data;
-};
-
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decoded_bbox[idx1*4 + 0];
-    float ymin1 = decoded_bbox[idx1*4 + 1];
-    float xmax1 = decoded_bbox[idx1*4 + 2];
-    float ymax1 = decoded_bbox[idx1*4 + 3];
-
-    float xmin2 = decoded_bbox[idx2*4 + 0];
-    float ymin2 = decoded_bbox[idx2*4 + 1];
-    float xmax2 = decoded_bbox[idx2*4 + 2];
-    float ymax2 = decoded_bbox[idx2*4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
+/**
+ * Sorts candidates by confidence in descending order and writes top_k of them to sorted,
+ * candidates with equal confidence are ordered by index
+ */
+static void sortTopK(const float *conf_data, const int *candidates, int count, int top_k, int *sorted) {
+    std::vector<std::pair<float, int>> scores(count);
+    for (int i = 0; i < count; ++i) {
+        scores[i] = std::make_pair(conf_data[candidates[i]], candidates[i]);
     }
 
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
+    // only top_k candidates have to be ordered
+    auto top_end = scores.begin() + top_k;
+    if (top_k < count) {
+        std::nth_element(scores.begin(), top_end, scores.end(), SortScorePairDescend<int>);
+    }
+    std::sort(scores.begin(), top_end, SortScorePairDescend<int>);
 
-    float intersect_width  = intersect_xmax - intersect_xmin;
-    float intersect_height = intersect_ymax - intersect_ymin;
+    for (int i = 0; i < top_k; ++i) {
+        sorted[i] = scores[i].second;
+    }
+}
 
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
+/**
+ * Greedy NMS over candidates sorted by confidence. Coordinates of kept boxes are stored separately,
+ * so overlaps of a candidate with all kept boxes are computed by a vectorized loop.
+ * @return Number of kept boxes written to kept
+ */
+static int nmsSorted(const int *sorted, int count, const float *bboxes, const float *sizes,
+                     float nms_threshold, int *kept) {
+    // NMS is called for every class of every image, so the buffer is reused by the calls running in the thread
+    thread_local std::vector<float> kept_boxes;
+    if (kept_boxes.size() < 5 * static_cast<size_t>(count)) {
+        kept_boxes.resize(5 * static_cast<size_t>(count));
     }
+    float *kept_xmin = kept_boxes.data();
+    float *kept_ymin = kept_xmin + count;
+    float *kept_xmax = kept_ymin + count;
+    float *kept_ymax = kept_xmax + count;
+    float *kept_size = kept_ymax + count;
+
+    const int block = 16;
+    int detections = 0;
+    for (int i = 0; i < count; ++i) {
+        const int idx = sorted[i];
+        const float xmin = bboxes[idx*4 + 0];
+        const float ymin = bboxes[idx*4 + 1];
+        const float xmax = bboxes[idx*4 + 2];
+        const float ymax = bboxes[idx*4 + 3];
+        const float size = sizes[idx];
 
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
+        bool keep = true;
+        for (int k0 = 0; keep && k0 < detections; k0 += block) {
+            const int k1 = (std::min)(detections, k0 + block);
+            int suppressed = 0;
+            for (int k = k0; k < k1; ++k) {
+                const float intersect_width  = (std::min)(xmax, kept_xmax[k]) - (std::max)(xmin, kept_xmin[k]);
+                const float intersect_height = (std::min)(ymax, kept_ymax[k]) - (std::max)(ymin, kept_ymin[k]);
+                const float intersect_size = intersect_width * intersect_height;
+                const float overlap = (intersect_width > 0 && intersect_height > 0) ?
+                                      intersect_size / (size + kept_size[k] - intersect_size) : 0.0f;
+                suppressed |= overlap > nms_threshold;
+            }
+            keep = suppressed == 0;
+        }
 
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
+        if (keep) {
+            kept_xmin[detections] = xmin;
+            kept_ymin[detections] = ymin;
+            kept_xmax[detections] = xmax;
+            kept_ymax[detections] = ymax;
+            kept_size[detections] = size;
+            kept[detections] = idx;
+            detections++;
+        }
+    }
+    return detections;
 }
 
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
@@ -563,37 +631,13 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                           int* indices,
                           int& detections,
                           int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        if (conf_data[i] > _confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
-    }
+    int count = filterByThreshold<false>(conf_data, num_priors_actual, _confidence_threshold, indices);
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    sortTopK(conf_data, indices, count, num_output_scores, buffer);
 
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
-    }
+    detections = nmsSorted(buffer, num_output_scores, bboxes, sizes, _nms_threshold, indices);
 }
 
 void DetectionOutputImpl::nms_mx(const float* conf_data,
@@ -603,55 +647,59 @@ void DetectionOutputImpl::nms_mx(const float* conf_data,
                           int* indices,
                           int* detections,
                           int num_priors_actual) {
-    int count = 0;
-    for (int i = 0; i < num_priors_actual; ++i) {
-        float conf = -1;
-        int id = 0;
-        for (int c = 1; c < _num_classes; ++c) {
-            float temp = conf_data[c*_num_priors + i];
-            if (temp > conf) {
-                conf = temp;
-                id = c;
+    // The best class of each prior, loops are ordered to read confidences of a class sequentially
+    std::vector<float> max_conf(num_priors_actual, -1.0f);
+    std::vector<int> max_ids(num_priors_actual, 0);
+    for (int c = 1; c < _num_classes; ++c) {
+        const float *pconf = conf_data + c*_num_priors;
+        for (int i = 0; i < num_priors_actual; ++i) {
+            if (pconf[i] > max_conf[i]) {
+                max_conf[i] = pconf[i];
+                max_ids[i] = c;
             }
         }
+    }
 
-        if (id > 0 && conf >= _confidence_threshold) {
-            indices[count++] = id*_num_priors + i;
+    // background has zero id and -1 confidence, so it is filtered by threshold or by id
+    int count = filterByThreshold<true>(max_conf.data(), num_priors_actual, _confidence_threshold, indices);
+    int valid_count = 0;
+    for (int i = 0; i < count; ++i) {
+        const int prior = indices[i];
+        if (max_ids[prior] > 0) {
+            indices[valid_count++] = max_ids[prior]*_num_priors + prior;
         }
     }
+    count = valid_count;
 
     int num_output_scores = (_top_k == -1 ? count : (std::min)(_top_k, count));
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    sortTopK(conf_data, indices, count, num_output_scores, buffer);
 
+    // Sorted candidates are grouped by class preserving the order, then classes are processed in parallel
+    std::vector<int> class_offsets(_num_classes + 1, 0);
     for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-        const int cls = idx/_num_priors;
-        const int prior = idx%_num_priors;
-
-        int &ndetection = detections[cls];
-        int *pindices = indices + cls*_num_priors;
+        class_offsets[buffer[i] / _num_priors + 1]++;
+    }
+    for (int c = 0; c < _num_classes; ++c) {
+        class_offsets[c + 1] += class_offsets[c];
+    }
+    std::vector<int> class_priors(num_output_scores);
+    std::vector<int> class_fill(class_offsets.begin(), class_offsets.end() - 1);
+    for (int i = 0; i < num_output_scores; ++i) {
+        const int cls = buffer[i] / _num_priors;
+        class_priors[class_fill[cls]++] = buffer[i] % _num_priors;
+    }
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int kept_idx = pindices[k];
-            float overlap = 0.0f;
-            if (_share_location) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, kept_idx);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls*_num_priors + prior, cls*_num_priors + kept_idx);
-            }
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
+    parallel_for(_num_classes, [&](int cls) {
+        const int class_count = class_offsets[cls + 1] - class_offsets[cls];
+        if (class_count == 0) {
+            return;
         }
-        if (keep) {
-            pindices[ndetection++] = prior;
-        }
-    }
+        const float *pboxes = _share_location ? bboxes : bboxes + cls*4*_num_priors;
+        const float *psizes = _share_location ? sizes : sizes + cls*_num_priors;
+        detections[cls] = nmsSorted(class_priors.data() + class_offsets[cls], class_count, pboxes, psizes,
+                                    _nms_threshold, indices + cls*_num_priors);
+    });
 }
 
 REG_FACTORY_FOR(DetectionOutputImpl, DetectionOutput);
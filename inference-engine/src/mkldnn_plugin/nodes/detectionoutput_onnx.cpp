@@ -14,32 +14,6 @@
 #include "ie_parallel.hpp"
 
 
-namespace {
-struct Indexer {
-  const std::vector<int> dims_;
-  int total_{1};
-
-  explicit Indexer(const std::vector<int>& dims) : dims_(dims) {
-      total_ = 1;
-      for (size_t i = 0; i < dims_.size(); ++i) {
-          total_ *= dims_[i];
-      }
-  }
-
-  int operator()(const std::vector<int>& idx) const {
-      int flat_idx = 0;
-      assert(idx.size() == dims_.size());
-      for (size_t i = 0; i < dims_.size(); ++i) {
-          assert(0 <= idx[i] && idx[i] < dims_[i]);
-          flat_idx = flat_idx * dims_[i] + idx[i];
-      }
-      assert(flat_idx < total_);
-      return flat_idx;
-  }
-};
-}  // namespace
-
-
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
@@ -51,21 +25,16 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
                   const float img_H, const float img_W,
                   const float max_delta_log_wh,
                   float coordinates_offset) {
-    Indexer box_idx({rois_num, 4});
-    Indexer delta_idx({rois_num, classes_num, 4});
-    Indexer score_idx({rois_num, classes_num});
-
-    Indexer refined_box_idx({classes_num, rois_num, 4});
-    Indexer refined_score_idx({classes_num, rois_num});
-
-    for (int roi_idx = 0; roi_idx < rois_num; ++roi_idx) {
-        float x0 = boxes[box_idx({roi_idx, 0})];
-        float y0 = boxes[box_idx({roi_idx, 1})];
-        float x1 = boxes[box_idx({roi_idx, 2})];
-        float y1 = boxes[box_idx({roi_idx, 3})];
+    // deltas are [rois_num, classes_num, 4] and scores are [rois_num, classes_num],
+    // refined boxes are [classes_num, rois_num, 4] and refined scores and areas are [classes_num, rois_num]
+    parallel_for(rois_num, [&](int roi_idx) {
+        const float x0 = boxes[roi_idx * 4 + 0];
+        const float y0 = boxes[roi_idx * 4 + 1];
+        const float x1 = boxes[roi_idx * 4 + 2];
+        const float y1 = boxes[roi_idx * 4 + 3];
 
         if (x1 - x0 <= 0 || y1 - y0 <= 0) {
-            continue;
+            return;
         }
 
         // width & height of box
@@ -76,10 +45,11 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
         const float ctr_y = y0 + 0.5f * hh;
 
         for (int class_idx = 1; class_idx < classes_num; ++class_idx) {
-            const float dx = deltas[delta_idx({roi_idx, class_idx, 0})] / weights[0];
-            const float dy = deltas[delta_idx({roi_idx, class_idx, 1})] / weights[1];
-            const float d_log_w = deltas[delta_idx({roi_idx, class_idx, 2})] / weights[2];
-            const float d_log_h = deltas[delta_idx({roi_idx, class_idx, 3})] / weights[3];
+            const float* delta = deltas + (roi_idx * classes_num + class_idx) * 4;
+            const float dx = delta[0] / weights[0];
+            const float dy = delta[1] / weights[1];
+            const float d_log_w = delta[2] / weights[2];
+            const float d_log_h = delta[3] / weights[3];
 
             // new center location according to deltas (dx, dy)
             const float pred_ctr_x = dx * ww + ctr_x;
@@ -105,29 +75,23 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
             const float box_w = x1_new - x0_new + coordinates_offset;
             const float box_h = y1_new - y0_new + coordinates_offset;
 
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 0})] = x0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 1})] = y0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 2})] = x1_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 3})] = y1_new;
+            const int refined_idx = class_idx * rois_num + roi_idx;
+            refined_boxes[refined_idx * 4 + 0] = x0_new;
+            refined_boxes[refined_idx * 4 + 1] = y0_new;
+            refined_boxes[refined_idx * 4 + 2] = x1_new;
+            refined_boxes[refined_idx * 4 + 3] = y1_new;
 
-            refined_boxes_areas[refined_score_idx({class_idx, roi_idx})] = box_w * box_h;
+            refined_boxes_areas[refined_idx] = box_w * box_h;
 
-            refined_scores[refined_score_idx({class_idx, roi_idx})] = scores[score_idx({roi_idx, class_idx})];
+            refined_scores[refined_idx] = scores[roi_idx * classes_num + class_idx];
         }
-    }
+    });
 }
 
-template <typename T>
-static bool SortScorePairDescend(const std::pair<float, T>& pair1,
-                                 const std::pair<float, T>& pair2) {
-    return pair1.first > pair2.first;
-}
-
-
 struct ConfidenceComparator {
     explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
 
-    bool operator()(int idx1, int idx2) {
+    bool operator()(int idx1, int idx2) const {
         if (_conf_data[idx1] > _conf_data[idx2]) return true;
         if (_conf_data[idx1] < _conf_data[idx2]) return false;
         return idx1 < idx2;
@@ -136,45 +100,6 @@ struct ConfidenceComparator {
     const float* _conf_data;
 };
 
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2,
-                                   const float coordinates_offset = 1) {
-    float xmin1 = decoded_bbox[idx1 * 4 + 0];
-    float ymin1 = decoded_bbox[idx1 * 4 + 1];
-    float xmax1 = decoded_bbox[idx1 * 4 + 2];
-    float ymax1 = decoded_bbox[idx1 * 4 + 3];
-
-    float xmin2 = decoded_bbox[idx2 * 4 + 0];
-    float ymin2 = decoded_bbox[idx2 * 4 + 1];
-    float ymax2 = decoded_bbox[idx2 * 4 + 3];
-    float xmax2 = decoded_bbox[idx2 * 4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin + coordinates_offset;
-    float intersect_height = intersect_ymax - intersect_ymin + coordinates_offset;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
-
-
 static void nms_cf(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
@@ -185,41 +110,70 @@ static void nms_cf(const float* conf_data,
                           const int pre_nms_topn,
                           const int post_nms_topn,
                           const float confidence_threshold,
-                          const float nms_threshold) {
+                          const float nms_threshold,
+                          const float coordinates_offset = 1) {
     int count = 0;
     for (int i = 0; i < boxes_num; ++i) {
         if (conf_data[i] > confidence_threshold) {
-            indices[count] = i;
+            buffer[count] = i;
             count++;
         }
     }
 
-    int num_output_scores = (pre_nms_topn == -1 ? count : (std::min)(pre_nms_topn, count));
+    const int num_output_scores = (pre_nms_topn == -1 ? count : (std::min)(pre_nms_topn, count));
+    const int max_detections = (post_nms_topn == -1 ? num_output_scores : (std::min)(post_nms_topn, num_output_scores));
+
+    // Candidates are popped from a heap in the order of decreasing confidence, so the sorting stops
+    // as soon as post_nms_topn boxes are kept, and only a small part of candidates is usually sorted
+    const ConfidenceComparator comparator(conf_data);
+    auto heap_comparator = [&comparator](int idx1, int idx2) { return comparator(idx2, idx1); };
+    std::make_heap(buffer, buffer + count, heap_comparator);
 
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    std::vector<float> kept_boxes(5 * max_detections);
+    float *kept_xmin = kept_boxes.data();
+    float *kept_ymin = kept_xmin + max_detections;
+    float *kept_xmax = kept_ymin + max_detections;
+    float *kept_ymax = kept_xmax + max_detections;
+    float *kept_size = kept_ymax + max_detections;
 
+    const int block = 16;
     detections = 0;
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
+    for (int i = 0; i < num_output_scores && detections < max_detections; ++i) {
+        std::pop_heap(buffer, buffer + count - i, heap_comparator);
+        const int idx = buffer[count - i - 1];
+        const float xmin = bboxes[idx * 4 + 0];
+        const float ymin = bboxes[idx * 4 + 1];
+        const float xmax = bboxes[idx * 4 + 2];
+        const float ymax = bboxes[idx * 4 + 3];
+        const float size = sizes[idx];
 
         bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > nms_threshold) {
-                keep = false;
-                break;
+        for (int k0 = 0; keep && k0 < detections; k0 += block) {
+            const int k1 = (std::min)(detections, k0 + block);
+            int suppressed = 0;
+            for (int k = k0; k < k1; ++k) {
+                const bool disjoint = (kept_xmin[k] > xmax) | (kept_xmax[k] < xmin) |
+                                      (kept_ymin[k] > ymax) | (kept_ymax[k] < ymin);
+                const float intersect_width  = (std::min)(xmax, kept_xmax[k]) - (std::max)(xmin, kept_xmin[k]) + coordinates_offset;
+                const float intersect_height = (std::min)(ymax, kept_ymax[k]) - (std::max)(ymin, kept_ymin[k]) + coordinates_offset;
+                const float intersect_size = intersect_width * intersect_height;
+                const float overlap = (!disjoint && intersect_width > 0 && intersect_height > 0) ?
+                                      intersect_size / (size + kept_size[k] - intersect_size) : 0.0f;
+                suppressed |= overlap > nms_threshold;
             }
+            keep = suppressed == 0;
         }
+
         if (keep) {
+            kept_xmin[detections] = xmin;
+            kept_ymin[detections] = ymin;
+            kept_xmax[detections] = xmax;
+            kept_ymax[detections] = ymax;
+            kept_size[detections] = size;
             indices[detections] = idx;
             detections++;
         }
     }
-
-    detections = (post_nms_topn == -1 ? detections : (std::min)(post_nms_topn, detections));
 }
 
 
@@ -300,8 +254,6 @@ public:
         std::vector<float> refined_boxes(classes_num_ * rois_num * 4, 0);
         std::vector<float> refined_scores(classes_num_ * rois_num, 0);
         std::vector<float> refined_boxes_areas(classes_num_ * rois_num, 0);
-        Indexer refined_box_idx({classes_num_, rois_num, 4});
-        Indexer refined_score_idx({classes_num_, rois_num});
 
         refine_boxes(boxes, deltas, &deltas_weights_[0], scores,
                      &refined_boxes[0], &refined_boxes_areas[0], &refined_scores[0],
@@ -310,48 +262,51 @@ public:
                      max_delta_log_wh_,
                      1.0f);
 
-        // Apply NMS class-wise.
-        std::vector<int> buffer(rois_num, 0);
+        // Apply NMS class-wise, classes are independent and processed in parallel.
+        std::vector<int> buffer(classes_num_ * rois_num, 0);
         std::vector<int> indices(classes_num_ * rois_num, 0);
         std::vector<int> detections_per_class(classes_num_, 0);
-        int total_detections_num = 0;
-
-        for (int class_idx = 1; class_idx < classes_num_; ++class_idx) {
-            nms_cf(&refined_scores[refined_score_idx({class_idx, 0})],
-                   &refined_boxes[refined_box_idx({class_idx, 0, 0})],
-                   &refined_boxes_areas[refined_score_idx({class_idx, 0})],
-                   &buffer[0],
-                   &indices[total_detections_num],
+
+        parallel_for(classes_num_ - 1, [&](int i) {
+            const int class_idx = i + 1;
+            nms_cf(&refined_scores[class_idx * rois_num],
+                   &refined_boxes[class_idx * rois_num * 4],
+                   &refined_boxes_areas[class_idx * rois_num],
+                   &buffer[class_idx * rois_num],
+                   &indices[class_idx * rois_num],
                    detections_per_class[class_idx],
                    rois_num,
                    -1,
                    max_detections_per_class_,
                    score_threshold_,
                    nms_threshold_);
-            total_detections_num += detections_per_class[class_idx];
-        }
+        });
 
         // Leave only max_detections_per_image_ detections.
         // confidence, <class, index>
         std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
 
-        int indices_offset = 0;
         for (int c = 0; c < classes_num_; ++c) {
             int n = detections_per_class[c];
             for (int i = 0; i < n; ++i) {
-                int idx = indices[indices_offset + i];
-                float score = refined_scores[refined_score_idx({c, idx})];
+                int idx = indices[c * rois_num + i];
+                float score = refined_scores[c * rois_num + idx];
                 conf_index_class_map.push_back(std::make_pair(score, std::make_pair(c, idx)));
             }
-            indices_offset += n;
         }
+        int total_detections_num = conf_index_class_map.size();
 
         assert(max_detections_per_image_ > 0);
         if (total_detections_num > max_detections_per_image_) {
+            // detections of equal confidence are ordered by class and index, so the result doesn't depend
+            // on the implementation of partial_sort
             std::partial_sort(conf_index_class_map.begin(),
                               conf_index_class_map.begin() + max_detections_per_image_,
                               conf_index_class_map.end(),
-                              SortScorePairDescend<std::pair<int, int>>);
+                              [](const std::pair<float, std::pair<int, int>>& lhs,
+                                 const std::pair<float, std::pair<int, int>>& rhs) {
+                return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+            });
             conf_index_class_map.resize(max_detections_per_image_);
             total_detections_num = max_detections_per_image_;
         }
@@ -366,10 +321,11 @@ public:
             float score = detection.first;
             int cls = detection.second.first;
             int idx = detection.second.second;
-            output_boxes[4 * i + 0] = refined_boxes[refined_box_idx({cls, idx, 0})];
-            output_boxes[4 * i + 1] = refined_boxes[refined_box_idx({cls, idx, 1})];
-            output_boxes[4 * i + 2] = refined_boxes[refined_box_idx({cls, idx, 2})];
-            output_boxes[4 * i + 3] = refined_boxes[refined_box_idx({cls, idx, 3})];
+            const float* box = &refined_boxes[(cls * rois_num + idx) * 4];
+            output_boxes[4 * i + 0] = box[0];
+            output_boxes[4 * i + 1] = box[1];
+            output_boxes[4 * i + 2] = box[2];
+            output_boxes[4 * i + 3] = box[3];
             output_scores[i] = score;
             output_classes[i] = cls;
             ++i;
@@ -4,6 +4,7 @@
 
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
 
 #include <vector>
 
@@ -40,6 +41,9 @@ public:
             case Precision::FP32: {
                 return processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
             }
+            case Precision::BF16: {
+                return processData<MKLDNNPlugin::bfloat16_t, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
+            }
             case Precision::I8: {
                 return processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
             }
@@ -61,20 +65,20 @@ public:
     }
 
 protected:
-    template<typename T>
+    template<typename S, typename D = S>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
                 ResponseDesc* resp) noexcept {
         switch (inputs[1]->getTensorDesc().getPrecision()) {
             case Precision::I32: {
-                return processData<T, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
+                return processData<S, D, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
             }
             case Precision::I64: {
-                return processData<T, PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
+                return processData<S, D, PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
             }
             case Precision::U64: {
-                return processData<T, PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
+                return processData<S, D, PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
             }
             default: {
                 if (resp) {
@@ -87,7 +91,7 @@ protected:
         }
     }
 
-    template<typename T, typename I>
+    template<typename S, typename D, typename I>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
@@ -95,9 +99,9 @@ protected:
         std::string errorMsg;
         std::string msgPrefix = std::string("Layer EmbeddingBagOffsetsSum with name '") + _layerName + "' ";
 
-        const T* srcData = inputs[0]->cbuffer().as<const T*>() +
+        const S* srcData = inputs[0]->cbuffer().as<const S*>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        T* dstData = outputs[0]->buffer().as<T*>() +
+        D* dstData = outputs[0]->buffer().as<D*>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         const I* indicesData = inputs[INDICES_IDX]->cbuffer().as<const I*>();
@@ -112,9 +116,9 @@ protected:
                 return GENERAL_ERROR;
             }
         }
-        const T* weightsData = nullptr;
+        const D* weightsData = nullptr;
         if (_withWeights)
-            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const D*>();
 
         const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
@@ -174,42 +178,12 @@ protected:
                 if (indices != nullptr) {
                     withWeights = withWeights & _withWeights;
 
-                    size_t inIdx = 0lu;
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                    size_t invalidIndex = 0lu;
+                    if (!sumBag(srcData, inDataDims[0], _embDepth, indices, indicesSize,
+                                withWeights ? weightsData + weightsIdx : nullptr, dstData + dstIndex, invalidIndex)) {
+                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(invalidIndex);
                         return;
                     }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i];
-                        }
-                    }
-
-                    for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                        if (indices[inIdx] >= inDataDims[0]) {
-                            errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                            return;
-                        }
-                        size_t srcIndex = indices[inIdx] * _embDepth;
-
-                        if (withWeights) {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                            }
-                            weightsIdx++;
-                        } else {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i];
-                            }
-                        }
-                    }
                 } else {
                     for (size_t i = 0lu; i < _embDepth; i++) {
                         dstData[dstIndex + i] = 0;
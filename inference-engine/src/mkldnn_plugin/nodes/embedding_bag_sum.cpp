@@ -5,6 +5,7 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 #include "list.hpp"
+#include "utils/bfloat16.hpp"
 
 #include <set>
 #include <string>
@@ -67,7 +68,8 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
             if (data == nullptr)
                 THROW_IE_EXCEPTION << logPrefix << "has nullable input data";
             auto prc = data->getTensorDesc().getPrecision();
-            if (prc == Precision::BF16)
+            // a BF16 table is read as is and summed in FP32, which halves the memory traffic of the lookups
+            if (prc == Precision::BF16 && i != 0)
                 prc = Precision::FP32;
             config.inConfs[i].desc = TensorDesc(prc,
                 data->getTensorDesc().getDims(),
@@ -103,6 +105,10 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
             processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
             break;
         }
+        case Precision::BF16: {
+            processData<MKLDNNPlugin::bfloat16_t, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+            break;
+        }
         case Precision::I8: {
             processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
             break;
@@ -128,17 +134,17 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
     return OK;
 }
 
-template<typename T>
+template<typename S, typename D>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs) noexcept {
-    const T* srcData = inputs[0]->cbuffer().as<const T*>() +
+    const S* srcData = inputs[0]->cbuffer().as<const S*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    T* dstData = outputs[0]->buffer().as<T*>() +
+    D* dstData = outputs[0]->buffer().as<D*>() +
         outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    const T* weightsData = nullptr;
+    const D* weightsData = nullptr;
     if (_withWeights)
-        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const D*>();
     initFromInputs(inputs);
 
     const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
@@ -163,40 +169,11 @@ void MKLDNNEmbeddingBagSum::processData(
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
+                size_t invalidIndex = 0lu;
+                if (!sumBag(srcData, inDataDims[0], _embDepth, indices, indicesSize,
+                            withWeights ? weightsData + weightsIdx : nullptr, dstData + dstIndex, invalidIndex))
                     THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
+                        << "' has invalid embedding bag index: " << invalidIndex;
             } else {
                 for (size_t i = 0lu; i < _embDepth; i++) {
                     dstData[dstIndex + i] = 0;
@@ -6,10 +6,15 @@
 
 #include "base.hpp"
 
+#include <cstring>
 #include <memory>
 #include <set>
 #include <vector>
 
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
@@ -38,9 +43,70 @@ protected:
         size_t& weightsIdx,
         bool& withWeights) = 0;
 
-    template<typename T>
+    template<typename S, typename D = S>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    /**
+     * Sums rows of the table of S elements selected by indices into dst, rows are multiplied by weights if they
+     * are given. Elements are accumulated in D, so rows of a BF16 table are summed in FP32.
+     * Returns false and the index if one of indices is out of the table.
+     */
+    template<typename S, typename D, typename I>
+    static bool sumBag(const S* table, size_t rowsNum, size_t embDepth, const I* indices, size_t indicesNum,
+                       const D* weights, D* dst, size_t& invalidIndex) noexcept {
+        for (size_t i = 0lu; i < indicesNum; i++) {
+            if (static_cast<size_t>(indices[i]) >= rowsNum) {
+                invalidIndex = static_cast<size_t>(indices[i]);
+                return false;
+            }
+        }
+
+        // Rows are read at random from a table which usually doesn't fit into caches, so the accumulation
+        // is bound by memory latency unless rows of next indices are loaded in advance.
+        const size_t rowSize = embDepth * sizeof(S);
+        auto prefetchRow = [&](size_t i) {
+            if (i >= indicesNum)
+                return;
+            const char* row = reinterpret_cast<const char*>(table + static_cast<size_t>(indices[i]) * embDepth);
+            for (size_t offset = 0lu; offset < rowSize; offset += CACHE_LINE_SIZE) {
+#if defined(_MSC_VER)
+                _mm_prefetch(row + offset, _MM_HINT_T0);
+#else
+                __builtin_prefetch(row + offset);
+#endif
+            }
+        };
+        for (size_t i = 0lu; i < PREFETCH_DISTANCE; i++)
+            prefetchRow(i);
+
+        for (size_t i = 0lu; i < indicesNum; i++) {
+            prefetchRow(i + PREFETCH_DISTANCE);
+            const S* row = table + static_cast<size_t>(indices[i]) * embDepth;
+            if (weights != nullptr) {
+                const D weight = weights[i];
+                if (i == 0lu) {
+                    for (size_t j = 0lu; j < embDepth; j++)
+                        dst[j] = static_cast<D>(row[j]) * weight;
+                } else {
+                    for (size_t j = 0lu; j < embDepth; j++)
+                        dst[j] += static_cast<D>(row[j]) * weight;
+                }
+            } else {
+                if (i == 0lu) {
+                    for (size_t j = 0lu; j < embDepth; j++)
+                        dst[j] = static_cast<D>(row[j]);
+                } else {
+                    for (size_t j = 0lu; j < embDepth; j++)
+                        dst[j] += static_cast<D>(row[j]);
+                }
+            }
+        }
+
+        if (indicesNum == 0lu)
+            std::memset(dst, 0, embDepth * sizeof(D));
+        return true;
+    }
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -56,6 +122,10 @@ protected:
     using UINT64 = PrecisionTrait<Precision::U64>::value_type;
 
     static const std::set<size_t> _supportedIndicesTypeSize;
+
+    static constexpr size_t CACHE_LINE_SIZE = 64lu;
+    // number of rows which are loaded ahead of the accumulated one
+    static constexpr size_t PREFETCH_DISTANCE = 8lu;
 };
 
 }  // namespace Cpu
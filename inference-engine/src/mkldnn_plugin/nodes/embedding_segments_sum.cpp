@@ -3,6 +3,7 @@
 //
 
 #include "embedding_bag_sum.hpp"
+#include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
 
 namespace InferenceEngine {
@@ -41,30 +42,20 @@ public:
             THROW_IE_EXCEPTION << errPrefix << "has unsupported input data type.";
 
         _indices = std::vector<size_t>(indicesData->getTensorDesc().getDims()[0], 0lu);
-        _segmentIds = std::vector<size_t>(segmentIdData->getTensorDesc().getDims()[0], 0lu);
     }
 
     void initFromInputs(std::vector<Blob::Ptr>& inputs) override {
         // Initialize indices
         if (inputs[INDICES_IDX]->getTensorDesc().getPrecision().size() == sizeof(INT32)) {
             const INT32* src = inputs[INDICES_IDX]->cbuffer().as<const INT32*>();
-            for (size_t i = 0lu; i < inputs[INDICES_IDX]->size(); i++)
+            parallel_for(inputs[INDICES_IDX]->size(), [&](size_t i) {
                 _indices[i] = static_cast<size_t>(src[i]);
+            });
         } else if (inputs[INDICES_IDX]->getTensorDesc().getPrecision().size() == sizeof(UINT64)) {
             const UINT64* src = inputs[INDICES_IDX]->cbuffer().as<const UINT64*>();
             cpu_memcpy(_indices.data(), src, inputs[INDICES_IDX]->byteSize());
         }
 
-        // Initialize segments ids
-        if (inputs[SEGMENT_ID_IDX]->getTensorDesc().getPrecision().size() == sizeof(INT32)) {
-            const INT32* src = inputs[SEGMENT_ID_IDX]->cbuffer().as<const INT32*>();
-            for (size_t i = 0lu; i < inputs[SEGMENT_ID_IDX]->size(); i++)
-                _segmentIds[i] = static_cast<size_t>(src[i]);
-        } else if (inputs[SEGMENT_ID_IDX]->getTensorDesc().getPrecision().size() == sizeof(UINT64)) {
-            const UINT64* src = inputs[SEGMENT_ID_IDX]->cbuffer().as<const UINT64*>();
-            cpu_memcpy(_segmentIds.data(), src, inputs[SEGMENT_ID_IDX]->byteSize());
-        }
-
         if (inputs.size() > NUM_SEGMENTS_IDX) {
             if (inputs[NUM_SEGMENTS_IDX]->getTensorDesc().getPrecision().size() == sizeof(INT32)) {
                 const INT32* src = inputs[NUM_SEGMENTS_IDX]->cbuffer().as<const INT32*>();
@@ -75,6 +66,23 @@ public:
             }
         }
 
+        // Initialize segments, indices of a segment are contiguous since segment ids are sorted
+        _segmentBegins.assign(_numSegments, 0lu);
+        _segmentSizes.assign(_numSegments, 0lu);
+        const size_t segmentIdsNum = inputs[SEGMENT_ID_IDX]->size();
+        const bool segmentIdsI32 = inputs[SEGMENT_ID_IDX]->getTensorDesc().getPrecision().size() == sizeof(INT32);
+        const INT32* segmentIdsI32Data = inputs[SEGMENT_ID_IDX]->cbuffer().as<const INT32*>();
+        const UINT64* segmentIdsU64Data = inputs[SEGMENT_ID_IDX]->cbuffer().as<const UINT64*>();
+        for (size_t si = 0lu; si < segmentIdsNum; si++) {
+            const size_t id = segmentIdsI32 ? static_cast<size_t>(segmentIdsI32Data[si])
+                                            : static_cast<size_t>(segmentIdsU64Data[si]);
+            if (id >= _numSegments)
+                continue;
+            if (_segmentSizes[id] == 0lu)
+                _segmentBegins[id] = si;
+            _segmentSizes[id]++;
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -93,17 +101,12 @@ public:
             THROW_IE_EXCEPTION << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentSizes[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
+        if (size != 0lu) {
+            indices = _indices.data() + _segmentBegins[embIndex];
+            weightsIdx = _segmentBegins[embIndex];
         }
 
         // Empty bag
@@ -123,7 +126,8 @@ protected:
     size_t _numSegments = 0lu;
 
     std::vector<size_t> _indices;
-    std::vector<size_t> _segmentIds;
+    std::vector<size_t> _segmentBegins;
+    std::vector<size_t> _segmentSizes;
     std::vector<size_t> _defaultIndices;
 };
 
@@ -18,6 +18,29 @@ MKLDNNGenericNode::MKLDNNGenericNode(const InferenceEngine::CNNLayerPtr& layer,
     blobs = layer->blobs;
 }
 
+MKLDNNGenericNode::MKLDNNGenericNode(const MKLDNNGenericNode& node) :
+        MKLDNNNode(node), extensionManager(node.extensionManager), params(node.params), blobs(node.blobs) {
+    // Implementations may keep intermediate data between calls, so the copy
+    // gets its own ones initialized with the selected configuration
+    created(extensionManager);
+    auto descriptor = getSelectedPrimitiveDescriptor();
+    if (descriptor == nullptr)
+        return;
+
+    initImplementations();
+    auto selectedImpl = getSelectedImplementation();
+    if (!selectedImpl)
+        THROW_IE_EXCEPTION << "Cannot find implementation of generic primitive for layer " << getName();
+
+    impls.clear();
+    impls.emplace_back(selectedImpl);
+    InferenceEngine::ResponseDesc resp;
+    auto rc = impls[0]->init(descriptor->getConfig(), &resp);
+    if (rc != InferenceEngine::OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+}
+
 void MKLDNNGenericNode::getSupportedDescriptors() {
     if (!extFactory && impls.empty()) {
         std::string type = getCnnLayer() ? getCnnLayer()->type : "Generic";
@@ -29,24 +52,9 @@ void MKLDNNGenericNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    InferenceEngine::ResponseDesc resp;
-    if (impls.empty()) {
-        if (!extFactory)
-            THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
-
-        std::vector<InferenceEngine::ILayerImpl::Ptr> impls_no_exec;
-
-        InferenceEngine::StatusCode rc = extFactory->getImplementations(impls_no_exec, &resp);
-        for (const auto& impl : impls_no_exec) {
-            if (auto exec_impl = std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impl)) {
-                impls.emplace_back(exec_impl);
-            }
-        }
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
-    }
+    initImplementations();
 
+    InferenceEngine::ResponseDesc resp;
     for (auto &impl : impls) {
         std::vector<InferenceEngine::LayerConfig> configs;
         auto rc = impl->getSupportedConfigurations(configs, &resp);
@@ -92,6 +100,7 @@ bool MKLDNNGenericNode::created(const MKLDNNExtensionManager::Ptr &extMgr) {
     if (getCnnLayer() && extMgr) {
         // We should save extension manager in order to avoid situation when
         // it will destroyed before extensibility primitives
+        extensionManager = extMgr;
         if (getCnnLayer()->getNode()) {
             auto impl = extMgr->CreateImplementation(getCnnLayer()->getNode());
             if (auto execImpl = std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impl))
@@ -107,6 +116,45 @@ bool MKLDNNGenericNode::created(const MKLDNNExtensionManager::Ptr &extMgr) {
     return created();
 }
 
+void MKLDNNGenericNode::initImplementations() {
+    if (!impls.empty())
+        return;
+    if (!extFactory)
+        THROW_IE_EXCEPTION << "Descriptor for generic primitive doesn't exist";
+
+    InferenceEngine::ResponseDesc resp;
+    std::vector<InferenceEngine::ILayerImpl::Ptr> impls_no_exec;
+
+    InferenceEngine::StatusCode rc = extFactory->getImplementations(impls_no_exec, &resp);
+    for (const auto& impl : impls_no_exec) {
+        if (auto exec_impl = std::dynamic_pointer_cast<InferenceEngine::ILayerExecImpl>(impl)) {
+            impls.emplace_back(exec_impl);
+        }
+    }
+    if (rc != InferenceEngine::OK) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+}
+
+InferenceEngine::ILayerExecImpl::Ptr MKLDNNGenericNode::getSelectedImplementation() const {
+    // supported primitive descriptors enumerate configurations of all implementations in order
+    InferenceEngine::ResponseDesc resp;
+    InferenceEngine::ILayerExecImpl::Ptr selectedImpl;
+    for (size_t k = 0, t = 0; k < impls.size(); k++) {
+        std::vector<InferenceEngine::LayerConfig> configs;
+        auto rc = impls[k]->getSupportedConfigurations(configs, &resp);
+        if (rc != InferenceEngine::OK) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+        for (size_t j = 0; j < configs.size(); j++, t++) {
+            if (t == selectedPrimitiveDescriptorIndex) {
+                selectedImpl = impls[k];
+            }
+        }
+    }
+    return selectedImpl;
+}
+
 void MKLDNNGenericNode::cleanup() {
     MKLDNNNode::cleanup();
     extFactory.reset();
@@ -167,19 +215,7 @@ void MKLDNNGenericNode::initDescriptor(const InferenceEngine::LayerConfig &confi
     InferenceEngine::StatusCode rc;
     InferenceEngine::ResponseDesc resp;
 
-    InferenceEngine::ILayerExecImpl::Ptr selectedImpl;
-    for (size_t k = 0, t = 0; k < impls.size(); k++) {
-        std::vector<InferenceEngine::LayerConfig> configs;
-        rc = impls[k]->getSupportedConfigurations(configs, &resp);
-        if (rc != InferenceEngine::OK) {
-            THROW_IE_EXCEPTION << resp.msg;
-        }
-        for (size_t j = 0; j < configs.size(); j++, t++) {
-            if (t == selectedPrimitiveDescriptorIndex) {
-                selectedImpl = impls[k];
-            }
-        }
-    }
+    InferenceEngine::ILayerExecImpl::Ptr selectedImpl = getSelectedImplementation();
 
     for (size_t j = 0; j < rightConfig.inConfs.size(); j++) {
         // TODO: we need to better recognize cases with possible inplace conficts
@@ -17,6 +17,7 @@ namespace MKLDNNPlugin {
 class MKLDNNGenericNode : public MKLDNNNode {
 public:
     MKLDNNGenericNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    MKLDNNGenericNode(const MKLDNNGenericNode& node);
     ~MKLDNNGenericNode() = default;
 
     void getSupportedDescriptors() override;
@@ -34,8 +35,11 @@ public:
     void execLayer();
     void cleanup() override;
 
-
 protected:
+    void initImplementations();
+    InferenceEngine::ILayerExecImpl::Ptr getSelectedImplementation() const;
+
+    MKLDNNExtensionManager::Ptr extensionManager;
     InferenceEngine::ILayerImplFactory::Ptr extFactory;
     std::vector<InferenceEngine::ILayerExecImpl::Ptr> impls;
     std::map<std::string, std::string> params;
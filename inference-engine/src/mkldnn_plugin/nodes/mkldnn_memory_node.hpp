@@ -87,6 +87,10 @@ class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
+// Memory nodes register themselves by id, so the copies would be bound to the siblings from the original graph
+template<>
+struct MKLDNNNodeCopyable<MKLDNNMemoryOutputNode> : std::false_type {};
+
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
 public:
@@ -107,6 +111,9 @@ public:
     MKLDNNMemoryPtr dataStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
+
+template<>
+struct MKLDNNNodeCopyable<MKLDNNMemoryInputNode> : std::false_type {};
 #endif
 
 }  // namespace MKLDNNPlugin
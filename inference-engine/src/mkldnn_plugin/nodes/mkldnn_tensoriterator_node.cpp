@@ -11,6 +11,7 @@
 #include <map>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <algorithm>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -112,6 +113,51 @@ private:
     int iter_count;
 };
 
+/**
+ * Rebinds body memory to the current chunk of the full tensor instead of copying the chunk.
+ * Applicable only if chunks are dense parts of the full tensor (see isDenseChunk).
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNEdgePtr> &part_edges,
+                   const InferenceEngine::TensorIterator::PortMap &slice_rule) {
+        auto axis = slice_rule.axis;
+        auto stride = slice_rule.stride;
+
+        auto full_dims = full_blob->GetDims();
+        auto abs_stride = std::abs(stride);
+        auto sign_of_stride = stride < 0.0f ? -1 : 1;
+
+        iter_count = full_dims[axis] / abs_stride;
+
+        chunk_stride_in_byte = MKLDNNExtensionUtils::sizeOfDataType(full_blob->GetDataType()) * abs_stride;
+        for (size_t i = axis + 1; i < full_dims.size(); i++)
+            chunk_stride_in_byte *= full_dims[i];
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+
+        mem_holder.push_back(full_blob->GetPrimitive());
+        for (const auto &edge : part_edges)
+            mem_holder.push_back(edge->getMemory().GetPrimitive());
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(mem_holder[FULL_DATA].get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (size_t i = FULL_DATA + 1; i < mem_holder.size(); i++)
+            mem_holder[i].set_data_handle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    const int FULL_DATA = 0;
+    int iter_count;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -125,6 +171,34 @@ public:
     }
 };
 
+/**
+ * Passes back edge data to the next iteration by swapping buffers of the body output and input
+ * (ping-pong buffers) instead of copying. Applicable only if both memories have the same descriptor.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<MKLDNNEdgePtr> &from_edges, const std::vector<MKLDNNEdgePtr> &to_edges) {
+        for (const auto &edge : from_edges)
+            mem_holder.push_back(edge->getMemory().GetPrimitive());
+        from_count = from_edges.size();
+        for (const auto &edge : to_edges)
+            mem_holder.push_back(edge->getMemory().GetPrimitive());
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter == 0)
+            return;
+
+        auto from_ptr = mem_holder.front().get_data_handle();
+        auto to_ptr = mem_holder.back().get_data_handle();
+        for (size_t i = 0; i < mem_holder.size(); i++)
+            mem_holder[i].set_data_handle(i < from_count ? to_ptr : from_ptr);
+    }
+
+private:
+    size_t from_count = 0;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -182,6 +256,56 @@ private:
     int value;
 };
 
+/**
+ * Checks whether chunks of the full tensor sliced along the axis can be used as the part tensor memory directly.
+ * Both tensors have to be plain and dense, and a chunk has to be a contiguous part of the full tensor.
+ */
+static bool isDenseChunk(const MKLDNNMemoryPtr &full_mem, const MKLDNNMemoryPtr &part_mem,
+                         const InferenceEngine::TensorIterator::PortMap &slice_rule) {
+    auto isPlainDense = [](const MKLDNNMemoryPtr &mem) {
+        const InferenceEngine::TensorDesc desc = MKLDNNMemoryDesc(mem->GetDescriptor());
+        const auto &blk = desc.getBlockingDesc();
+        const auto &dims = desc.getDims();
+        if (blk.getOffsetPadding() != 0 || blk.getBlockDims() != dims)
+            return false;
+        for (auto offset : blk.getOffsetPaddingToData()) {
+            if (offset != 0)
+                return false;
+        }
+        size_t dense_stride = 1;
+        for (size_t i = dims.size(); i-- > 0;) {
+            if (blk.getOrder()[i] != i || (dims[i] != 1 && blk.getStrides()[i] != dense_stride))
+                return false;
+            dense_stride *= dims[i];
+        }
+        return true;
+    };
+
+    if (full_mem->GetDataType() != part_mem->GetDataType() || !isPlainDense(full_mem) || !isPlainDense(part_mem))
+        return false;
+
+    auto full_dims = full_mem->GetDims();
+    for (int i = 0; i < slice_rule.axis; i++) {
+        if (full_dims[i] != 1)
+            return false;
+    }
+    full_dims[slice_rule.axis] = std::abs(slice_rule.stride);
+    return full_dims == part_mem->GetDims();
+}
+
+/**
+ * Checks that memory of the edges is not used by any other edge of the graph
+ */
+static bool hasNoAliases(MKLDNNGraph &graph, const std::vector<MKLDNNEdgePtr> &edges) {
+    const auto data = edges.front()->getMemory().GetPrimitive().get_data_handle();
+    for (const auto &edge : graph.GetEdges()) {
+        if (std::find(edges.begin(), edges.end(), edge) == edges.end() &&
+                edge->getMemory().GetPrimitive().get_data_handle() == data)
+            return false;
+    }
+    return true;
+}
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
@@ -203,6 +327,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
         input_mem.push_back(in_mem);
+        input_nodes.push_back(in_node);
     }
 
     // Assume that order of outputs in original TI and produces sub_graph is same
@@ -210,9 +335,32 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     for (size_t i = 0; i < out_vec.size(); i++) {
         auto out_mem = out_vec[i]->getParentEdgeAt(0)->getMemoryPtr();
         output_mem.push_back(out_mem);
+        output_nodes.push_back(out_vec[i]);
     }
 }
 
+std::vector<MKLDNNEdgePtr> MKLDNNTensorIteratorNode::getReboundableInputEdges(int idx) {
+    if (input_rebound[idx] || !MKLDNNGraph::CanChangeInputPtr(input_nodes[idx]))
+        return {};
+
+    std::vector<MKLDNNEdgePtr> edges;
+    for (size_t i = 0; i < input_nodes[idx]->getChildEdges().size(); i++)
+        edges.push_back(input_nodes[idx]->getChildEdgeAt(i));
+    if (edges.empty() || !hasNoAliases(sub_graph, edges))
+        return {};
+    return edges;
+}
+
+std::vector<MKLDNNEdgePtr> MKLDNNTensorIteratorNode::getReboundableOutputEdges(int idx) {
+    if (output_rebound[idx] || !MKLDNNGraph::CanChangeOutputPtr(output_nodes[idx]))
+        return {};
+
+    std::vector<MKLDNNEdgePtr> edges = {output_nodes[idx]->getParentEdgeAt(0)};
+    if (!hasNoAliases(sub_graph, edges))
+        return {};
+    return edges;
+}
+
 void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -229,31 +377,69 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // Sliced ports and back edges rebind body memory instead of copying data where it is possible.
+    // Each body memory can be rebound only by a single mapper.
+    input_rebound.assign(input_mem.size(), false);
+    output_rebound.assign(output_mem.size(), false);
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
+            continue;
+        }
+
+        auto view_edges = isDenseChunk(from_mem, to_mem, map_rule) ? getReboundableInputEdges(map_rule.to)
+                                                                   : std::vector<MKLDNNEdgePtr>{};
+        if (!view_edges.empty()) {
+            input_rebound[map_rule.to] = true;
+            before_mappers.emplace_back(new PortViewHelper(from_mem, view_edges, map_rule));
+        } else {
             before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+        }
     }
 
+    // Mappers which rebind body outputs have to be applied after all mappers which may read
+    // outputs of the previous iteration, so they are appended to before_mappers at the end
+    std::vector<std::shared_ptr<PortMapHelper>> output_view_mappers, swap_mappers;
     for (auto map_rule : ti->output_port_map) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
+            continue;
+        }
+
+        auto view_edges = isDenseChunk(to_mem, from_mem, map_rule) ? getReboundableOutputEdges(map_rule.to)
+                                                                   : std::vector<MKLDNNEdgePtr>{};
+        if (!view_edges.empty()) {
+            output_rebound[map_rule.to] = true;
+            output_view_mappers.emplace_back(new PortViewHelper(to_mem, view_edges, map_rule));
+        } else {
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+        }
     }
 
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        std::vector<MKLDNNEdgePtr> from_edges, to_edges;
+        if (MKLDNNMemoryDesc(from_mem->GetDescriptor()) == MKLDNNMemoryDesc(to_mem->GetDescriptor()) &&
+                from_mem->GetData() != to_mem->GetData()) {
+            from_edges = getReboundableOutputEdges(map_rule.from);
+            to_edges = getReboundableInputEdges(map_rule.to);
+        }
+        if (!from_edges.empty() && !to_edges.empty()) {
+            output_rebound[map_rule.from] = true;
+            input_rebound[map_rule.to] = true;
+            swap_mappers.emplace_back(new BackEdgeSwapHelper(from_edges, to_edges));
+        } else {
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        }
     }
 
     // special purpose ports
@@ -268,6 +454,9 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         before_mappers.emplace_back(new IterCountPortHelper(to_mem, eng));
     }
 
+    before_mappers.insert(before_mappers.end(), swap_mappers.begin(), swap_mappers.end());
+    before_mappers.insert(before_mappers.end(), output_view_mappers.begin(), output_view_mappers.end());
+
     auto condition_port_idx = ti->GetParamAsInt(key_cond_port, -1);
     if (condition_port_idx == -1) {
         continue_cond_check.reset(new staticValueCheck(true)); // always true
@@ -56,11 +56,26 @@ public:
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 
 private:
+    /**
+     * Returns edges which memory has to be rebound to pass data to the body input without copying
+     * or empty vector if the body may write to the input memory or use it as a view.
+     */
+    std::vector<MKLDNNEdgePtr> getReboundableInputEdges(int idx);
+    /**
+     * Returns edges which memory has to be rebound to get data from the body output without copying
+     * or empty vector if the output memory is shared with other body edges.
+     */
+    std::vector<MKLDNNEdgePtr> getReboundableOutputEdges(int idx);
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
+
+    /// Body ports which memory is already rebound by some port mapper
+    std::vector<bool> input_rebound, output_rebound;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
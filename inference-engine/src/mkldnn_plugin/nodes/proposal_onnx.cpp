@@ -17,28 +17,12 @@
 #include "ie_parallel.hpp"
 
 
-namespace {
-struct Indexer4d {
-  int dim3_;
-  int dim23_;
-  int dim123_;
-
-  explicit Indexer4d(int dim0, int dim1, int dim2, int dim3):
-      dim3_(dim3), dim23_(dim2 * dim3), dim123_(dim1 * dim2 * dim3) {
-      (void)dim0;
-  }
-
-  int operator()(int i, int j, int k, int n) const {
-      return  i * dim123_ + j * dim23_ + k * dim3_ + n;
-  }
-};
-}  // namespace
-
-
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+// Proposals are decoded to planes of x0, y0, x1, y1 and score of [anchors_num, bottom_H, bottom_W] layout,
+// so deltas and scores are read and proposals are written along contiguous rows of the feature map.
 static
 void refine_anchors(const float* deltas, const float* scores, const float* anchors,
                     float* proposals, const int anchors_num, const int bottom_H,
@@ -46,74 +30,109 @@ void refine_anchors(const float* deltas, const float* scores, const float* ancho
                     const float min_box_H, const float min_box_W,
                     const float max_delta_log_wh,
                     float coordinates_offset) {
-    Indexer4d delta_idx(anchors_num, 4, bottom_H, bottom_W);
-    Indexer4d score_idx(anchors_num, 1, bottom_H, bottom_W);
-    Indexer4d proposal_idx(bottom_H, bottom_W, anchors_num, 5);
-    Indexer4d anchor_idx(bottom_H, bottom_W, anchors_num, 4);
-
-    parallel_for2d(bottom_H, bottom_W, [&](int h, int w) {
-            for (int anchor = 0; anchor < anchors_num; ++anchor) {
-                int a_idx = anchor_idx(h, w, anchor, 0);
-                float x0 = anchors[a_idx + 0];
-                float y0 = anchors[a_idx + 1];
-                float x1 = anchors[a_idx + 2];
-                float y1 = anchors[a_idx + 3];
-
-                const float dx = deltas[delta_idx(anchor, 0, h, w)];
-                const float dy = deltas[delta_idx(anchor, 1, h, w)];
-                const float d_log_w = deltas[delta_idx(anchor, 2, h, w)];
-                const float d_log_h = deltas[delta_idx(anchor, 3, h, w)];
-
-                const float score = scores[score_idx(anchor, 0, h, w)];
-
-                // width & height of box
-                const float ww = x1 - x0 + coordinates_offset;
-                const float hh = y1 - y0 + coordinates_offset;
-                // center location of box
-                const float ctr_x = x0 + 0.5f * ww;
-                const float ctr_y = y0 + 0.5f * hh;
-
-                // new center location according to deltas (dx, dy)
-                const float pred_ctr_x = dx * ww + ctr_x;
-                const float pred_ctr_y = dy * hh + ctr_y;
-                // new width & height according to deltas d(log w), d(log h)
-                const float pred_w = std::exp(std::min(d_log_w, max_delta_log_wh)) * ww;
-                const float pred_h = std::exp(std::min(d_log_h, max_delta_log_wh)) * hh;
-
-                // update upper-left corner location
-                x0 = pred_ctr_x - 0.5f * pred_w;
-                y0 = pred_ctr_y - 0.5f * pred_h;
-                // update lower-right corner location
-                x1 = pred_ctr_x + 0.5f * pred_w - coordinates_offset;
-                y1 = pred_ctr_y + 0.5f * pred_h - coordinates_offset;
-
-                // adjust new corner locations to be within the image region,
-                x0 = std::max<float>(0.0f, std::min<float>(x0, img_W - coordinates_offset));
-                y0 = std::max<float>(0.0f, std::min<float>(y0, img_H - coordinates_offset));
-                x1 = std::max<float>(0.0f, std::min<float>(x1, img_W - coordinates_offset));
-                y1 = std::max<float>(0.0f, std::min<float>(y1, img_H - coordinates_offset));
-
-                // recompute new width & height
-                const float box_w = x1 - x0 + coordinates_offset;
-                const float box_h = y1 - y0 + coordinates_offset;
-
-                int p_idx = proposal_idx(h, w, anchor, 0);
-                proposals[p_idx + 0] = x0;
-                proposals[p_idx + 1] = y0;
-                proposals[p_idx + 2] = x1;
-                proposals[p_idx + 3] = y1;
-                proposals[p_idx + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
-            }
+    const int plane_size = bottom_H * bottom_W;
+    const int num_proposals = anchors_num * plane_size;
+
+    parallel_for2d(anchors_num, bottom_H, [&](int anchor, int h) {
+        // anchors are [bottom_H, bottom_W, anchors_num, 4]
+        const float* p_anchors = anchors + (h * bottom_W * anchors_num + anchor) * 4;
+        const int anchors_stride = anchors_num * 4;
+        const float* p_dx = deltas + (anchor * 4 + 0) * plane_size + h * bottom_W;
+        const float* p_dy = deltas + (anchor * 4 + 1) * plane_size + h * bottom_W;
+        const float* p_d_log_w = deltas + (anchor * 4 + 2) * plane_size + h * bottom_W;
+        const float* p_d_log_h = deltas + (anchor * 4 + 3) * plane_size + h * bottom_W;
+        const float* p_score = scores + anchor * plane_size + h * bottom_W;
+
+        const int offset = anchor * plane_size + h * bottom_W;
+        float* p_x0 = proposals + 0 * num_proposals + offset;
+        float* p_y0 = proposals + 1 * num_proposals + offset;
+        float* p_x1 = proposals + 2 * num_proposals + offset;
+        float* p_y1 = proposals + 3 * num_proposals + offset;
+        float* p_proposal_score = proposals + 4 * num_proposals + offset;
+
+        for (int w = 0; w < bottom_W; ++w) {
+            float x0 = p_anchors[w * anchors_stride + 0];
+            float y0 = p_anchors[w * anchors_stride + 1];
+            float x1 = p_anchors[w * anchors_stride + 2];
+            float y1 = p_anchors[w * anchors_stride + 3];
+
+            const float dx = p_dx[w];
+            const float dy = p_dy[w];
+            const float d_log_w = p_d_log_w[w];
+            const float d_log_h = p_d_log_h[w];
+
+            const float score = p_score[w];
+
+            // width & height of box
+            const float ww = x1 - x0 + coordinates_offset;
+            const float hh = y1 - y0 + coordinates_offset;
+            // center location of box
+            const float ctr_x = x0 + 0.5f * ww;
+            const float ctr_y = y0 + 0.5f * hh;
+
+            // new center location according to deltas (dx, dy)
+            const float pred_ctr_x = dx * ww + ctr_x;
+            const float pred_ctr_y = dy * hh + ctr_y;
+            // new width & height according to deltas d(log w), d(log h)
+            const float pred_w = std::exp(std::min(d_log_w, max_delta_log_wh)) * ww;
+            const float pred_h = std::exp(std::min(d_log_h, max_delta_log_wh)) * hh;
+
+            // update upper-left corner location
+            x0 = pred_ctr_x - 0.5f * pred_w;
+            y0 = pred_ctr_y - 0.5f * pred_h;
+            // update lower-right corner location
+            x1 = pred_ctr_x + 0.5f * pred_w - coordinates_offset;
+            y1 = pred_ctr_y + 0.5f * pred_h - coordinates_offset;
+
+            // adjust new corner locations to be within the image region,
+            x0 = std::max<float>(0.0f, std::min<float>(x0, img_W - coordinates_offset));
+            y0 = std::max<float>(0.0f, std::min<float>(y0, img_H - coordinates_offset));
+            x1 = std::max<float>(0.0f, std::min<float>(x1, img_W - coordinates_offset));
+            y1 = std::max<float>(0.0f, std::min<float>(y1, img_H - coordinates_offset));
+
+            // recompute new width & height
+            const float box_w = x1 - x0 + coordinates_offset;
+            const float box_h = y1 - y0 + coordinates_offset;
+
+            p_x0[w] = x0;
+            p_y0[w] = y0;
+            p_x1[w] = x1;
+            p_y1[w] = y1;
+            p_proposal_score[w] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
+        }
     });
 }
 
-static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn) {
+// Selects pre_nms_topn proposals of the highest score ordered by decreasing score, proposals of equal score
+// are ordered as anchors are enumerated in the input, i.e. by (h, w, anchor)
+static void sort_proposals(const float* proposals, int* sorted, const int anchors_num, const int bottom_H,
+                           const int bottom_W, const int pre_nms_topn) {
+    const int plane_size = bottom_H * bottom_W;
+    const int num_proposals = anchors_num * plane_size;
+    const float* score = proposals + 4 * num_proposals;
+
+    auto order = [&](int idx) { return (idx % plane_size) * anchors_num + idx / plane_size; };
+    auto comparator = [&](int idx1, int idx2) {
+        return score[idx1] > score[idx2] || (score[idx1] == score[idx2] && order(idx1) < order(idx2));
+    };
+
+    std::vector<int> indices(num_proposals);
+    for (int i = 0; i < num_proposals; ++i) {
+        indices[i] = i;
+    }
+    // most of proposals are rejected by a single comparison with the top of the heap of pre_nms_topn proposals
+    std::partial_sort_copy(indices.begin(), indices.end(), sorted, sorted + pre_nms_topn, comparator);
+}
+
+static void unpack_boxes(const float* proposals, const int* sorted, float* unpacked_boxes,
+                         const int num_proposals, const int pre_nms_topn) {
     parallel_for(pre_nms_topn, [&](size_t i) {
-        unpacked_boxes[0*pre_nms_topn + i] = p_proposals[5*i + 0];
-        unpacked_boxes[1*pre_nms_topn + i] = p_proposals[5*i + 1];
-        unpacked_boxes[2*pre_nms_topn + i] = p_proposals[5*i + 2];
-        unpacked_boxes[3*pre_nms_topn + i] = p_proposals[5*i + 3];
-        unpacked_boxes[4*pre_nms_topn + i] = p_proposals[5*i + 4];
+        const int idx = sorted[i];
+        unpacked_boxes[0*pre_nms_topn + i] = proposals[0*num_proposals + idx];
+        unpacked_boxes[1*pre_nms_topn + i] = proposals[1*num_proposals + idx];
+        unpacked_boxes[2*pre_nms_topn + i] = proposals[2*num_proposals + idx];
+        unpacked_boxes[3*pre_nms_topn + i] = proposals[3*num_proposals + idx];
+        unpacked_boxes[4*pre_nms_topn + i] = proposals[4*num_proposals + idx];
     });
 }
 
@@ -363,16 +382,10 @@ public:
 
         // enumerate all proposals
         //   num_proposals = num_anchors * H * W
-        //   (x1, y1, x2, y2, score) for each proposal
+        //   planes of x1, y1, x2, y2 and score for all proposals
         // NOTE: for bottom, only foreground scores are passed
-        struct ProposalBox {
-            float x0;
-            float y0;
-            float x1;
-            float y1;
-            float score;
-        };
-        std::vector<ProposalBox> proposals_(num_proposals);
+        std::vector<float> proposals_(5 * num_proposals);
+        std::vector<int> sorted_(pre_nms_topn);
         std::vector<float> unpacked_boxes(5 * pre_nms_topn);
         std::vector<int> is_dead(pre_nms_topn);
 
@@ -380,17 +393,14 @@ public:
         int batch_size = 1;  // inputs[INPUT_DELTAS]->getTensorDesc().getDims()[0];
         for (int n = 0; n < batch_size; ++n) {
             refine_anchors(p_deltas_item, p_scores_item, p_anchors_item,
-                           reinterpret_cast<float *>(&proposals_[0]), anchors_num, bottom_H,
+                           &proposals_[0], anchors_num, bottom_H,
                            bottom_W, img_H, img_W,
                            min_box_H, min_box_W,
                            static_cast<const float>(log(1000. / 16.)),
                            1.0f);
-            std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                              [](const ProposalBox& struct1, const ProposalBox& struct2) {
-                                  return (struct1.score > struct2.score);
-                              });
+            sort_proposals(&proposals_[0], &sorted_[0], anchors_num, bottom_H, bottom_W, pre_nms_topn);
 
-            unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn);
+            unpack_boxes(&proposals_[0], &sorted_[0], &unpacked_boxes[0], num_proposals, pre_nms_topn);
             nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], &roi_indices_[0], &num_rois, 0,
                     nms_thresh_, post_nms_topn_, coordinates_offset);
             fill_output_blobs(&unpacked_boxes[0], &roi_indices_[0], p_roi_item, p_roi_score_item,
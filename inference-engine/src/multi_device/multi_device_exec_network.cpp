@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -48,6 +50,26 @@ struct IdleGuard {
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
 };
 
+double MultiDeviceExecutableNetwork::DeviceStatistics::ExpectedTime() const {
+    // the requests of the device are served in parallel, so a new one waits for the outstanding ones in batches
+    return (_inFlight.load() + 1) * _serviceTime.load() / _numRequests;
+}
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::OnStarted() {
+    ++_inFlight;
+}
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::OnFinished(std::chrono::steady_clock::time_point startTime) {
+    const double time = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+        std::chrono::steady_clock::now() - startTime).count();
+    // exponentially weighted moving average, so the estimation follows the changes of the device load
+    auto serviceTime = _serviceTime.load();
+    while (!_serviceTime.compare_exchange_weak(serviceTime,
+                                               (0.0 == serviceTime) ? time : serviceTime + (time - serviceTime) / 8)) {
+    }
+    --_inFlight;
+}
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
@@ -59,6 +81,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end()) {
+        _schedulingPolicy = ParseSchedulingPolicy(itPolicy->second.as<std::string>());
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -78,18 +104,22 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto& statistics = _deviceStatistics[device];
+        statistics._numRequests = std::max(numRequests, 1u);
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
+            workerRequest._statistics = &statistics;
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    workerRequestPtr->_statistics->OnFinished(workerRequestPtr->_startTime);
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -114,6 +144,26 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (preferred_device.empty() && (SchedulingPolicy::LeastOutstanding == _schedulingPolicy) && (devices.size() > 1)) {
+        // the expected times are snapshotted, as they keep changing while the devices are sorted
+        std::vector<double> expectedTimes;
+        for (auto&& device : devices) {
+            expectedTimes.push_back(_deviceStatistics.at(device.deviceName).ExpectedTime());
+        }
+        std::vector<std::size_t> order(devices.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        // devices that are equally fast keep their priority order
+        std::stable_sort(order.begin(), order.end(), [&] (std::size_t lhs, std::size_t rhs) {
+            return expectedTimes[lhs] < expectedTimes[rhs];
+        });
+        std::vector<DeviceInformation> sortedDevices;
+        for (auto&& i : order) {
+            sortedDevices.push_back(std::move(devices[i]));
+        }
+        devices = std::move(sortedDevices);
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
@@ -206,14 +256,36 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
     return asyncRequest;
 }
 
+MultiDeviceExecutableNetwork::SchedulingPolicy MultiDeviceExecutableNetwork::ParseSchedulingPolicy(const std::string& policy) {
+    if (policy == MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY) {
+        return SchedulingPolicy::DevicePriority;
+    } else if (policy == MultiDeviceConfigParams::MULTI_LEAST_OUTSTANDING) {
+        return SchedulingPolicy::LeastOutstanding;
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported value " << policy << " for the MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+    }
+}
+
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
-        THROW_IE_EXCEPTION << "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (config.empty() ||
+        config.size() != static_cast<std::size_t>(priorities != config.end()) + static_cast<std::size_t>(policy != config.end())) {
+        THROW_IE_EXCEPTION << "The only configs supported for the Network's SetConfig are "
+                           << "MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES and MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+    }
+
+    // validate both values before changing anything
+    auto schedulingPolicy = _schedulingPolicy.load();
+    if (policy != config.end()) {
+        schedulingPolicy = ParseSchedulingPolicy(policy->second);
+    }
+
+    std::vector<DeviceInformation> metaDevices;
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
-        auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
+        metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
 
         if (std::any_of(metaDevices.begin(), metaDevices.end(), [](const DeviceInformation& kvp) {
                 return kvp.numRequestsPerDevices != -1;
@@ -221,9 +293,11 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             THROW_IE_EXCEPTION << "You can only change device priorities but not number of requests"
                      <<" with the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES!";
         }
+    }
 
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (priorities != config.end()) {
             for (auto && device : metaDevices) {
                 if (_networksPerDevice.find(device.deviceName) == _networksPerDevice.end()) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "You can only change device priorities but not add new devices with"
@@ -237,6 +311,10 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
         }
+        if (policy != config.end()) {
+            _schedulingPolicy = schedulingPolicy;
+            _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policy->second;
+        }
     }
 }
 
@@ -276,7 +354,8 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(SUPPORTED_CONFIG_KEYS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -6,8 +6,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <thread>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -61,36 +64,102 @@ protected:
     std::queue<T>   _queue;
     std::mutex      _mutex;
 };
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue. The buffer is allocated by the first set_capacity()
+ *        call, which should not be concurrent with other calls. Later calls only open or close the queue.
+ */
 template <typename T>
 class ThreadSafeBoundedQueue {
 public:
     ThreadSafeBoundedQueue() = default;
     bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
+        if (!_capacity) {
+            return false;
+        }
+        Cell* cell = nullptr;
+        auto pos = _pushPos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto seq = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (0 == diff) {
+                if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell may still be read by a consumer which has already taken its value,
+                // then the queue is not full and the cell is released soon
+                auto size = static_cast<std::ptrdiff_t>(pos - _popPos.load(std::memory_order_relaxed));
+                if (size > static_cast<std::ptrdiff_t>(_mask)) {
+                    return false;
+                }
+                std::this_thread::yield();
+                pos = _pushPos.load(std::memory_order_relaxed);
+            } else {
+                pos = _pushPos.load(std::memory_order_relaxed);
+            }
         }
-        return _capacity;
+        cell->_value = std::move(value);
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+        return true;
     }
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
+        if (!_capacity) {
             return false;
         }
+        Cell* cell = nullptr;
+        auto pos = _popPos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            auto seq = cell->_sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (0 == diff) {
+                if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // the cell may still be written by a producer which has already taken it,
+                // then the queue is not empty and the value is stored soon
+                auto size = static_cast<std::ptrdiff_t>(_pushPos.load(std::memory_order_relaxed) - pos);
+                if (size <= 0) {
+                    return false;
+                }
+                std::this_thread::yield();
+                pos = _popPos.load(std::memory_order_relaxed);
+            } else {
+                pos = _popPos.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(cell->_value);
+        cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+        return true;
     }
     void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
+        if (nullptr == _cells && 0 != newCapacity) {
+            // the algorithm needs a power of two buffer of at least two cells
+            std::size_t size = 2;
+            while (size < newCapacity) {
+                size *= 2;
+            }
+            _cells.reset(new Cell[size]);
+            for (std::size_t i = 0; i < size; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+            _mask = size - 1;
+        }
+        _capacity = (nullptr != _cells) && (0 != newCapacity);
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
-    bool            _capacity = false;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    std::atomic<std::size_t>    _pushPos = {0};
+    std::atomic<std::size_t>    _popPos = {0};
+    std::atomic<bool>           _capacity = {false};
 };
 #endif
 
@@ -98,10 +167,27 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    enum class SchedulingPolicy {
+        DevicePriority,
+        LeastOutstanding
+    };
+    // Load of a device used by the scheduling policies
+    struct DeviceStatistics {
+        double ExpectedTime() const;
+        void OnStarted();
+        void OnFinished(std::chrono::steady_clock::time_point startTime);
+
+        std::size_t             _numRequests = 1;
+        std::atomic<int>        _inFlight = {0};
+        // smoothed inference time of a request in microseconds, zero until the first request is finished
+        std::atomic<double>     _serviceTime = {0.0};
+    };
     struct WorkerInferRequest {
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        DeviceStatistics*               _statistics = nullptr;
+        std::chrono::steady_clock::time_point _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -122,6 +208,8 @@ public:
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
 
+    static SchedulingPolicy ParseSchedulingPolicy(const std::string& policy);
+
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
     // the bug is e.g. manifesting on the old CentOS (and it's 4.8.x gcc) used in our testing
@@ -135,6 +223,9 @@ public:
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    // filled by the constructor for every device, the map itself is only read by the concurrent requests
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    std::atomic<SchedulingPolicy>                               _schedulingPolicy = {SchedulingPolicy::DevicePriority};
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
@@ -58,17 +58,18 @@ protected:
     /**
      * @brief Creates asyncronous inference request from synchronous request returned by CreateInferRequestImpl
      * @tparam AsyncInferRequestType A type of asynchronous inference request to use a wrapper for synchronous request
+     * @param args Additional arguments passed to the AsyncInferRequestType constructor after the executors
      * @return A shared pointer to an asynchronous inference request
      */
-    template <typename AsyncInferRequestType = AsyncInferRequestThreadSafeDefault>
-    IInferRequest::Ptr CreateAsyncInferRequestFromSync() {
+    template <typename AsyncInferRequestType = AsyncInferRequestThreadSafeDefault, typename... Args>
+    IInferRequest::Ptr CreateAsyncInferRequestFromSync(Args&&... args) {
         IInferRequest::Ptr asyncRequest;
 
         auto syncRequestImpl = this->CreateInferRequestImpl(_networkInputs, _networkOutputs);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
 
         auto asyncThreadSafeImpl = std::make_shared<AsyncInferRequestType>(
-            syncRequestImpl, _taskExecutor, _callbackExecutor);
+            syncRequestImpl, _taskExecutor, _callbackExecutor, std::forward<Args>(args)...);
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestType>(asyncThreadSafeImpl),
             [](IInferRequest *p) { p->Release(); });
         asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
@@ -236,6 +236,19 @@ protected:
         }
     }
 
+    /**
+     * @brief Moves input data pre-processing out of the inference task to a new first stage of
+     * AsyncInferRequestThreadSafeDefault::_pipeline, so pre-processing of a request overlaps with inference of
+     * previously started requests. The stage is skipped if the inputs of a request need no pre-processing.
+     * @note Should be called after the rest of the pipeline is defined
+     * @param[in]  preprocessingExecutor The executor that runs pre-processing
+     */
+    void AddPreprocessingStage(const ITaskExecutor::Ptr& preprocessingExecutor) {
+        IE_ASSERT(nullptr != preprocessingExecutor);
+        _preprocessingExecutor = preprocessingExecutor;
+        _pipeline.insert(_pipeline.begin(), {preprocessingExecutor, [this] {_syncRequest->Preprocess();}});
+    }
+
     /**
      * @brief Implements Infer() using StartAsync() and Wait()
      */
@@ -259,12 +272,19 @@ protected:
     ITaskExecutor::Ptr _requestExecutor;  //!< Used to run inference CPU tasks.
     ITaskExecutor::Ptr _callbackExecutor;  //!< Used to run post inference callback in asynchronous pipline
     ITaskExecutor::Ptr _syncCallbackExecutor;  //!< Used to run post inference callback in synchronous pipline
+    ITaskExecutor::Ptr _preprocessingExecutor;  //!< Used to run the pre-processing stage of asynchronous pipeline
     Pipeline _pipeline;  //!< Pipeline variable that should be filled by inherited class.
     Pipeline _syncPipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
 
     void StartAsync_ThreadUnsafe() override {
         _syncRequest->checkBlobs();
-        RunFirstStage(_pipeline.begin(), _pipeline.end(), _callbackExecutor);
+        auto itFirstStage = _pipeline.begin();
+        if (nullptr != _preprocessingExecutor && _pipeline.size() > 1 &&
+            std::get<Stage_e::executor>(*itFirstStage) == _preprocessingExecutor &&
+            !_syncRequest->isPreprocessingRequired()) {
+            ++itFirstStage;
+        }
+        RunFirstStage(itFirstStage, _pipeline.end(), _callbackExecutor);
     }
 
     void Infer_ThreadUnsafe() override {
@@ -63,6 +63,23 @@ public:
         InferImpl();
     }
 
+    /**
+     * @brief Executes input data pre-processing ahead of inference, e.g. as a separate stage of an asynchronous
+     *        pipeline. The next InferRequestInternal::execDataPreprocessing call for the inputs does not repeat it.
+     */
+    virtual void Preprocess() {
+        execDataPreprocessing(_inputs);
+        _inputsPreprocessed = true;
+    }
+
+    /**
+     * @brief Checks whether inputs set to the request need pre-processing
+     * @return `True` if InferRequestInternal::Preprocess has work to do
+     */
+    virtual bool isPreprocessingRequired() const {
+        return !_preProcData.empty();
+    }
+
     /**
      * @brief Default common implementation for all plugins
      */
@@ -247,6 +264,7 @@ protected:
     InferenceEngine::BlobMap _outputs;  //!< A map of user passed blobs for network outputs
     std::map<std::string, PreProcessDataPtr> _preProcData;        //!< A map of pre-process data per input
     int m_curBatch;  //!< Current batch value used in dynamic batching
+    bool _inputsPreprocessed = false;  //!< Inputs are already pre-processed by InferRequestInternal::Preprocess
 
     /**
      * @brief A shared pointer to ExecutableNetworkInternal interface
@@ -259,6 +277,10 @@ protected:
      * @param serial Whether to use multiple threads to execute the step
      */
     void execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial = false) {
+        if (&preprocessedBlobs == &_inputs && _inputsPreprocessed) {
+            _inputsPreprocessed = false;
+            return;
+        }
         for (auto& input : preprocessedBlobs) {
             // If there is a pre-process entry for an input then it must be pre-processed
             // using preconfigured resize algorithm.
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ie_api.h"
+#include <exception>
 #include <vector>
 
 namespace InferenceEngine {
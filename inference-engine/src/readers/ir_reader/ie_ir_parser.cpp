@@ -623,6 +623,7 @@ std::shared_ptr<ngraph::Node> V10Parser::XmlDeserializer::createNode(
                                                     const Blob::CPtr& weights,
                                                     const GenericLayerParams& params) {
     static std::vector<std::shared_ptr<LayerBaseCreator>> creators = {
+        std::make_shared<LayerCreator<ngraph::op::Constant>>("Const"),
         std::make_shared<LayerCreator<ngraph::op::v1::DeformableConvolution>>("DeformableConvolution"),
         std::make_shared<LayerCreator<ngraph::op::v1::DeformablePSROIPooling>>("DeformablePSROIPooling"),
         std::make_shared<LayerCreator<ngraph::op::v1::GreaterEqual>>("GreaterEqual"),
@@ -1306,6 +1307,41 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::Deformable
     }
 }
 
+// Constant layer
+template <>
+std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::createLayer(
+        const ngraph::OutputVector& inputs, const pugi::xml_node& node, const Blob::CPtr& weights,
+        const GenericLayerParams& layerParsePrms) {
+    checkParameters(inputs, layerParsePrms, 0);
+    pugi::xml_node dn = node.child("data");
+
+    if (dn.empty())
+        THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
+
+    size_t offset = GetUInt64Attr(dn, "offset");
+    size_t size = GetUInt64Attr(dn, "size");
+    ngraph::element::Type el_type = details::convertPrecision(GetStrAttr(dn, "element_type"));
+    ngraph::Shape shape = getParameters<size_t>(dn, "shape", {});
+
+    size_t length = weights ? weights->byteSize() : 0;
+    if (!length)
+        THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+    if (length < offset + size)
+        THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+    if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
+        THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << getType() << " op!";
+
+    char* data = weights->cbuffer().as<char*>() + offset;
+    // data at an offset not aligned to the element type is copied into an aligned buffer of the constant
+    if (el_type.size() != 0 && reinterpret_cast<std::uintptr_t>(data) % el_type.size() != 0)
+        return std::make_shared<ngraph::op::Constant>(el_type, shape, data);
+
+    // Constant refers to the weights instead of copying them and keeps the weights blob alive
+    Blob::CPtr weightsHolder = weights;
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, weightsHolder);
+    return std::make_shared<ngraph::op::Constant>(el_type, shape, buffer);
+}
+
 // LogicalAnd layer
 template <>
 std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v1::LogicalAnd>::createLayer(
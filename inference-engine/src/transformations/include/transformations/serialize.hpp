@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <ostream>
 #include <string>
 
 #include "ngraph/opsets/opset.hpp"
@@ -26,6 +27,10 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - constants with identical data share the data in the bin file
+ * - if compressToFP16 is set, FP32 weights representable in FP16 are stored
+ * as FP16 constants followed by Convert to FP32; constants which reach shape
+ * inputs (e.g. Interpolate-4 scales or Range inputs) stay FP32
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
@@ -34,11 +39,22 @@ public:
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
     Serialize(const std::string& xmlPath, const std::string& binPath,
-              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {});
+              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {},
+              bool compressToFP16 = false);
+
+    /**
+     * @brief Serializes into the given streams instead of files. Streams must outlive the pass.
+     */
+    Serialize(std::ostream& xmlFile, std::ostream& binFile,
+              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {},
+              bool compressToFP16 = false);
 
 private:
+    std::ostream* m_xmlFile = nullptr;
+    std::ostream* m_binFile = nullptr;
     const std::string m_xmlPath;
     const std::string m_binPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    const bool m_compressToFP16;
 };
@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <transformations_visibility.hpp>
+
+namespace ngraph {
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief DataHash computes 64-bit non-cryptographic xxHash64 of data.
+ * Data is processed by 32 byte stripes in 4 independent 64-bit lanes, so it is hashed
+ * a word at a time instead of a byte at a time. Data may be passed in any number of
+ * update calls, the digest depends on the bytes only, not on how they were split.
+ */
+class TRANSFORMATIONS_API DataHash {
+public:
+    explicit DataHash(uint64_t seed = 0);
+
+    void update(const void* data, size_t size);
+
+    uint64_t digest() const;
+
+    static uint64_t hash(const void* data, size_t size, uint64_t seed = 0);
+
+private:
+    static constexpr size_t stripe_bytes = 32;
+
+    void consume(const unsigned char* stripe);
+
+    uint64_t m_seed;
+    uint64_t m_lanes[4];
+    unsigned char m_stripe[stripe_bytes];
+    size_t m_stripe_size = 0;
+    uint64_t m_size = 0;
+};
+
+}  // namespace ngraph
@@ -4,7 +4,9 @@
 
 #include <array>
 #include <cassert>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -14,6 +16,7 @@
 #include "ngraph/opsets/opset.hpp"
 #include "pugixml.hpp"
 #include "transformations/serialize.hpp"
+#include "transformations/utils/data_hash.hpp"
 
 using namespace ngraph;
 
@@ -55,9 +58,43 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
+// Writes constant payloads into the weights stream. Payloads equal to an
+// already written one are not written again but refer to its offset, the
+// IR reader creates Constants on top of the weights so they share the data
+// after loading too.
+class ConstantWriter {
+public:
+    explicit ConstantWriter(std::ostream& bin_data) : m_bin_data(bin_data) {}
+
+    // data must be alive until the writer is destroyed
+    int64_t write(const char* data, size_t size) {
+        auto& candidates = m_written_data[DataHash::hash(data, size)];
+        for (const auto& written : candidates) {
+            if (written.size == size &&
+                (written.data == data || std::memcmp(written.data, data, size) == 0)) {
+                return written.offset;
+            }
+        }
+        const int64_t offset = m_bin_data.tellp();
+        m_bin_data.write(data, size);
+        candidates.push_back({data, size, offset});
+        return offset;
+    }
+
+private:
+    struct WrittenData {
+        const char* data;
+        size_t size;
+        int64_t offset;
+    };
+
+    std::ostream& m_bin_data;
+    std::unordered_map<uint64_t, std::vector<WrittenData>> m_written_data;
+};
+
 class XmlSerializer : public ngraph::AttributeVisitor {
     pugi::xml_node& m_xml_node;
-    std::ostream& m_bin_data;
+    ConstantWriter& m_constant_writer;
     std::string& m_node_type_name;
 
     template <typename T>
@@ -68,10 +105,10 @@ class XmlSerializer : public ngraph::AttributeVisitor {
 
 public:
     XmlSerializer(pugi::xml_node& data,
-                  std::ostream& bin_data,
+                  ConstantWriter& constant_writer,
                   std::string& node_type_name)
         : m_xml_node(data)
-        , m_bin_data(bin_data)
+        , m_constant_writer(constant_writer)
         , m_node_type_name(node_type_name) {
     }
 
@@ -88,13 +125,11 @@ public:
                 ngraph::AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>;
             if (auto a = ngraph::as_type<AlignedBufferAdapter>(&adapter)) {
                 const int64_t size = a->size();
-                const int64_t offset = m_bin_data.tellp();
+                const int64_t offset = m_constant_writer.write(
+                    static_cast<const char*>(a->get_ptr()), size);
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
-
-                auto data = static_cast<const char*>(a->get_ptr());
-                m_bin_data.write(data, size);
             }
         }
     }
@@ -177,8 +212,12 @@ const std::unordered_map<ngraph::Node*, int> create_layer_ids(
     return layer_ids;
 }
 
+// compressed_layers maps ids of compressed Const layers to ids of the Convert
+// layers which decompress them, consumers of the constants are connected to
+// the Convert layers
 const std::vector<Edge> create_edge_mapping(
     const std::unordered_map<ngraph::Node*, int>& layer_ids,
+    const std::unordered_map<int, int>& compressed_layers,
     const ngraph::Function& f) {
     std::vector<Edge> edges;
     for (const auto& node : f.get_ordered_ops()) {
@@ -202,9 +241,18 @@ const std::vector<Edge> create_edge_mapping(
                 source_node->get_input_size() + source_output.get_index();
             e.to_layer = layer_ids.find(current_node)->second;
             e.to_port = i.get_index();
+            auto compressed = compressed_layers.find(e.from_layer);
+            if (compressed != compressed_layers.end()) {
+                // Convert has one input port, so its output port is 1
+                e.from_layer = compressed->second;
+                e.from_port = 1;
+            }
             edges.push_back(e);
         }
     }
+    for (const auto& compressed : compressed_layers) {
+        edges.push_back(Edge{compressed.first, 0, compressed.second, 0});
+    }
     std::sort(begin(edges), end(edges),
               [](const Edge& a, const Edge& b) -> bool {
                   return a.from_layer < b.from_layer;
@@ -375,10 +423,161 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
     return true;
 }
 
+// Returns FP16 copy of the FP32 constant or nullptr if the constant is not
+// FP32 or some of its values are out of FP16 range
+std::shared_ptr<ngraph::op::Constant> compress_to_fp16(const ngraph::Node* node) {
+    auto constant = dynamic_cast<const ngraph::op::Constant*>(node);
+    if (constant == nullptr || constant->get_element_type() != ngraph::element::f32) {
+        return nullptr;
+    }
+    const float* src = constant->get_data_ptr<float>();
+    const size_t count = ngraph::shape_size(constant->get_shape());
+    std::vector<ngraph::float16> dst(count);
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = ngraph::float16(src[i]);
+        const float value = static_cast<float>(dst[i]);
+        // overflow to infinity and underflow to zero are not acceptable, e.g.
+        // for epsilons of normalizations
+        if ((std::isinf(value) && !std::isinf(src[i])) || (value == 0.0f && src[i] != 0.0f)) {
+            return nullptr;
+        }
+    }
+    return std::make_shared<ngraph::op::Constant>(ngraph::element::f16,
+                                                  constant->get_shape(),
+                                                  dst.data());
+}
+
+// Inputs taking shapes, axes, indices or other values which must stay exact,
+// e.g. Interpolate-4 scales define the output shape
+bool is_shape_input(const ngraph::Input<ngraph::Node>& input) {
+    const auto node = input.get_node();
+    return input.get_element_type().is_integral_number() ||
+           (ngraph::is_type<ngraph::op::v4::Interpolate>(node) && input.get_index() > 0) ||
+           ngraph::is_type<ngraph::op::v0::Range>(node) ||
+           ngraph::is_type<ngraph::op::v4::Range>(node);
+}
+
+// Returns constants of the shape subgraph: the nodes which don't depend on the
+// values of the parameters and whose values reach shape inputs
+std::unordered_set<const ngraph::Node*> get_shape_subgraph_constants(
+    const std::vector<std::shared_ptr<ngraph::Node>>& ordered_ops) {
+    std::unordered_set<const ngraph::Node*> value_independent;
+    for (const auto& node : ordered_ops) {
+        bool independent = ngraph::op::is_constant(node) ||
+                           ngraph::is_type<ngraph::op::v0::ShapeOf>(node) ||
+                           ngraph::is_type<ngraph::op::v3::ShapeOf>(node);
+        if (!independent && node->get_input_size() > 0) {
+            independent = true;
+            for (const auto& input : node->inputs()) {
+                independent &= value_independent.count(
+                    input.get_source_output().get_node()) != 0;
+            }
+        }
+        if (independent) {
+            value_independent.insert(node.get());
+        }
+    }
+
+    std::unordered_set<const ngraph::Node*> shape_subgraph;
+    std::unordered_set<const ngraph::Node*> constants;
+    for (auto it = ordered_ops.rbegin(); it != ordered_ops.rend(); ++it) {
+        const auto& node = *it;
+        if (value_independent.count(node.get()) == 0) {
+            continue;
+        }
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                if (is_shape_input(input) ||
+                    shape_subgraph.count(input.get_node()) != 0) {
+                    shape_subgraph.insert(node.get());
+                }
+            }
+        }
+        if (shape_subgraph.count(node.get()) != 0 &&
+            ngraph::op::is_constant(node)) {
+            constants.insert(node.get());
+        }
+    }
+    return constants;
+}
+
+void append_layer(pugi::xml_node& layers, int layer_id, ngraph::Node* node,
+                  bool exec_graph, ConstantWriter& constant_writer,
+                  std::unordered_set<std::string>& unique_names,
+                  const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    // <layers>
+    pugi::xml_node layer = layers.append_child("layer");
+    layer.append_attribute("id").set_value(layer_id);
+    layer.append_attribute("name").set_value(
+        get_node_unique_name(unique_names, node).c_str());
+    auto layer_type_attribute = layer.append_attribute("type");
+    if (!exec_graph) {
+        layer.append_attribute("version").set_value(
+            get_opset_name(node, custom_opsets).c_str());
+    }
+    // <layers/data>
+    pugi::xml_node data = layer.append_child("data");
+
+    // <layers/data> general attributes
+    std::string node_type_name{node->get_type_name()};
+    if (exec_graph) {
+        visit_exec_graph_node(data, node_type_name, node);
+    } else {
+        XmlSerializer visitor(data, constant_writer, node_type_name);
+        NGRAPH_CHECK(node->visit_attributes(visitor),
+                     "Visitor API is not supported in ", node);
+    }
+    layer_type_attribute.set_value(
+        translate_type_name(node_type_name).c_str());
+
+    const auto data_attr_size =
+        std::distance(data.attributes().begin(), data.attributes().end());
+    if (data_attr_size == 0) {
+        layer.remove_child(data);
+    }
+
+    int port_id = 0;
+    // <layers/input>
+    if (node->get_input_size() > 0) {
+        pugi::xml_node input = layer.append_child("input");
+        for (auto i : node->inputs()) {
+            NGRAPH_CHECK(i.get_partial_shape().is_static(),
+                         "Unsupported dynamic input shape in ", node);
+
+            pugi::xml_node port = input.append_child("port");
+            port.append_attribute("id").set_value(port_id++);
+            for (auto d : i.get_shape()) {
+                pugi::xml_node dim = port.append_child("dim");
+                dim.append_child(pugi::xml_node_type::node_pcdata)
+                    .set_value(std::to_string(d).c_str());
+            }
+        }
+    }
+    // <layers/output>
+    if ((node->get_output_size() > 0) && !ngraph::op::is_output(node)) {
+        pugi::xml_node output = layer.append_child("output");
+        for (auto o : node->outputs()) {
+            NGRAPH_CHECK(o.get_partial_shape().is_static(),
+                         "Unsupported dynamic output shape in ", node);
+
+            pugi::xml_node port = output.append_child("port");
+            port.append_attribute("id").set_value(port_id++);
+            port.append_attribute("precision")
+                .set_value(get_output_precision_name(o).c_str());
+            for (auto d : o.get_shape()) {
+                pugi::xml_node dim = port.append_child("dim");
+                dim.append_child(pugi::xml_node_type::node_pcdata)
+                    .set_value(std::to_string(d).c_str());
+            }
+        }
+    }
+}
+
 void ngfunction_2_irv10(pugi::xml_document& doc,
                         std::ostream& bin_file,
                         const ngraph::Function& f,
-                        const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+                        const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                        bool compress_to_fp16_weights) {
     const bool exec_graph = is_exec_graph(f);
 
     pugi::xml_node netXml = doc.append_child("net");
@@ -392,79 +591,53 @@ void ngfunction_2_irv10(pugi::xml_document& doc,
 
     bool has_dynamic_shapes = resolve_dynamic_shapes(f);
 
-    for (const auto& n : f.get_ordered_ops()) {
+    ConstantWriter constant_writer(bin_file);
+    // FP16 constants and Convert layers are not a part of the function and
+    // are kept alive here, the writer refers to their data
+    std::vector<std::shared_ptr<ngraph::Node>> decompressions;
+    std::unordered_map<int, int> compressed_layers;
+    int next_layer_id = static_cast<int>(layer_ids.size());
+
+    const auto ordered_ops = f.get_ordered_ops();
+    // only weights are compressed, values of the shape subgraph stay exact
+    std::unordered_set<const ngraph::Node*> shape_subgraph_constants;
+    if (compress_to_fp16_weights && !exec_graph) {
+        shape_subgraph_constants = get_shape_subgraph_constants(ordered_ops);
+    }
+
+    for (const auto& n : ordered_ops) {
         ngraph::Node* node = n.get();
 
         NGRAPH_CHECK(layer_ids.find(node) != layer_ids.end(), "Internal error");
-        // <layers>
-        pugi::xml_node layer = layers.append_child("layer");
-        layer.append_attribute("id").set_value(layer_ids.find(node)->second);
-        layer.append_attribute("name").set_value(
-            get_node_unique_name(unique_names, node).c_str());
-        auto layer_type_attribute = layer.append_attribute("type");
-        if (!exec_graph) {
-            layer.append_attribute("version").set_value(
-                get_opset_name(node, custom_opsets).c_str());
-        }
-        // <layers/data>
-        pugi::xml_node data = layer.append_child("data");
+        const int layer_id = layer_ids.find(node)->second;
 
-        // <layers/data> general attributes
-        std::string node_type_name{node->get_type_name()};
-        if (exec_graph) {
-            visit_exec_graph_node(data, node_type_name, node);
-        } else {
-            XmlSerializer visitor(data, bin_file, node_type_name);
-            NGRAPH_CHECK(node->visit_attributes(visitor),
-                         "Visitor API is not supported in ", node);
+        std::shared_ptr<ngraph::op::Constant> compressed;
+        if (compress_to_fp16_weights && !exec_graph &&
+            shape_subgraph_constants.count(node) == 0) {
+            compressed = compress_to_fp16(node);
         }
-        layer_type_attribute.set_value(
-            translate_type_name(node_type_name).c_str());
-
-        const auto data_attr_size =
-            std::distance(data.attributes().begin(), data.attributes().end());
-        if (data_attr_size == 0) {
-            layer.remove_child(data);
-        }
-
-        int port_id = 0;
-        // <layers/input>
-        if (node->get_input_size() > 0) {
-            pugi::xml_node input = layer.append_child("input");
-            for (auto i : node->inputs()) {
-                NGRAPH_CHECK(i.get_partial_shape().is_static(),
-                             "Unsupported dynamic input shape in ", node);
-
-                pugi::xml_node port = input.append_child("port");
-                port.append_attribute("id").set_value(port_id++);
-                for (auto d : i.get_shape()) {
-                    pugi::xml_node dim = port.append_child("dim");
-                    dim.append_child(pugi::xml_node_type::node_pcdata)
-                        .set_value(std::to_string(d).c_str());
-                }
-            }
-        }
-        // <layers/output>
-        if ((node->get_output_size() > 0) && !ngraph::op::is_output(node)) {
-            pugi::xml_node output = layer.append_child("output");
-            for (auto o : node->outputs()) {
-                NGRAPH_CHECK(o.get_partial_shape().is_static(),
-                             "Unsupported dynamic output shape in ", node);
-
-                pugi::xml_node port = output.append_child("port");
-                port.append_attribute("id").set_value(port_id++);
-                port.append_attribute("precision")
-                    .set_value(get_output_precision_name(o).c_str());
-                for (auto d : o.get_shape()) {
-                    pugi::xml_node dim = port.append_child("dim");
-                    dim.append_child(pugi::xml_node_type::node_pcdata)
-                        .set_value(std::to_string(d).c_str());
-                }
-            }
+        if (compressed) {
+            // FP16 Const followed by Convert to FP32 under the original name
+            auto convert = std::make_shared<ngraph::op::v0::Convert>(
+                compressed, ngraph::element::f32);
+            compressed->set_friendly_name(node->get_friendly_name() + "/compressed_to_f16");
+            convert->set_friendly_name(node->get_friendly_name());
+            decompressions.push_back(convert);
+
+            const int convert_id = next_layer_id++;
+            compressed_layers[layer_id] = convert_id;
+            append_layer(layers, layer_id, compressed.get(), exec_graph,
+                         constant_writer, unique_names, custom_opsets);
+            append_layer(layers, convert_id, convert.get(), exec_graph,
+                         constant_writer, unique_names, custom_opsets);
+        } else {
+            append_layer(layers, layer_id, node, exec_graph, constant_writer,
+                         unique_names, custom_opsets);
         }
     }
     // <edges>
-    const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
+    const std::vector<Edge> edge_mapping =
+        create_edge_mapping(layer_ids, compressed_layers, f);
     pugi::xml_node edges = netXml.append_child("edges");
     for (auto e : edge_mapping) {
         pugi::xml_node edge = edges.append_child("edge");
@@ -486,11 +659,15 @@ void ngfunction_2_irv10(pugi::xml_document& doc,
 bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     // prepare data
     pugi::xml_document xml_doc;
-    std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
-    NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
+    std::ofstream bin_file;
+    if (m_binFile == nullptr) {
+        bin_file.open(m_binPath, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
+    }
+    std::ostream& bin_stream = m_binFile ? *m_binFile : bin_file;
     switch (m_version) {
     case Version::IR_V10:
-        ngfunction_2_irv10(xml_doc, bin_file, *f, m_custom_opsets);
+        ngfunction_2_irv10(xml_doc, bin_stream, *f, m_custom_opsets, m_compressToFP16);
         break;
     default:
         NGRAPH_UNREACHABLE("Unsupported version");
@@ -498,11 +675,16 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     }
 
     // create xml file
-    std::ofstream xml_file(m_xmlPath, std::ios::out);
-    NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
-    xml_doc.save(xml_file);
-    xml_file.flush();
-    bin_file.flush();
+    if (m_xmlFile == nullptr) {
+        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
+        xml_doc.save(xml_file);
+        xml_file.flush();
+    } else {
+        xml_doc.save(*m_xmlFile);
+        m_xmlFile->flush();
+    }
+    bin_stream.flush();
 
     // Return false because we didn't change nGraph Function
     return false;
@@ -538,11 +720,28 @@ std::string provide_bin_path(const std::string &xmlPath, const std::string &binP
 pass::Serialize::Serialize(const std::string& xmlPath,
                            const std::string& binPath,
                            pass::Serialize::Version version,
-                           std::map<std::string, OpSet> custom_opsets)
+                           std::map<std::string, OpSet> custom_opsets,
+                           bool compressToFP16)
     : m_xmlPath{valid_xml_path(xmlPath)}
     , m_binPath{provide_bin_path(xmlPath, binPath)}
     , m_version{version}
     , m_custom_opsets{custom_opsets}
+    , m_compressToFP16{compressToFP16}
+{
+}
+
+pass::Serialize::Serialize(std::ostream& xmlFile,
+                           std::ostream& binFile,
+                           pass::Serialize::Version version,
+                           std::map<std::string, OpSet> custom_opsets,
+                           bool compressToFP16)
+    : m_xmlFile{&xmlFile}
+    , m_binFile{&binFile}
+    , m_xmlPath{}
+    , m_binPath{}
+    , m_version{version}
+    , m_custom_opsets{custom_opsets}
+    , m_compressToFP16{compressToFP16}
 {
 }
 // ! [function_pass:serialize_cpp]
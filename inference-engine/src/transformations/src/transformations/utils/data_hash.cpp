@@ -0,0 +1,124 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/utils/data_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const unsigned char* data) {
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const unsigned char* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint64_t hash_round(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t value) {
+    acc ^= hash_round(0, value);
+    return acc * prime1 + prime4;
+}
+
+}  // namespace
+
+constexpr size_t ngraph::DataHash::stripe_bytes;
+
+ngraph::DataHash::DataHash(uint64_t seed)
+    : m_seed(seed)
+    , m_lanes{seed + prime1 + prime2, seed + prime2, seed, seed - prime1} {}
+
+void ngraph::DataHash::consume(const unsigned char* stripe) {
+    for (size_t lane = 0; lane < 4; lane++) {
+        m_lanes[lane] = hash_round(m_lanes[lane], read64(stripe + 8 * lane));
+    }
+}
+
+void ngraph::DataHash::update(const void* data, size_t size) {
+    auto bytes = static_cast<const unsigned char*>(data);
+    m_size += size;
+
+    if (m_stripe_size != 0) {
+        auto count = std::min(size, stripe_bytes - m_stripe_size);
+        std::memcpy(m_stripe + m_stripe_size, bytes, count);
+        m_stripe_size += count;
+        bytes += count;
+        size -= count;
+        if (m_stripe_size < stripe_bytes) {
+            return;
+        }
+        consume(m_stripe);
+        m_stripe_size = 0;
+    }
+    for (; size >= stripe_bytes; bytes += stripe_bytes, size -= stripe_bytes) {
+        consume(bytes);
+    }
+    if (size != 0) {
+        std::memcpy(m_stripe, bytes, size);
+    }
+    m_stripe_size = size;
+}
+
+uint64_t ngraph::DataHash::digest() const {
+    uint64_t h;
+    if (m_size >= stripe_bytes) {
+        h = rotl(m_lanes[0], 1) + rotl(m_lanes[1], 7) + rotl(m_lanes[2], 12) + rotl(m_lanes[3], 18);
+        for (auto lane : m_lanes) {
+            h = merge_round(h, lane);
+        }
+    } else {
+        h = m_seed + prime5;
+    }
+    h += m_size;
+
+    const unsigned char* data = m_stripe;
+    const unsigned char* end = m_stripe + m_stripe_size;
+    for (; data + 8 <= end; data += 8) {
+        h ^= hash_round(0, read64(data));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (data + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(data)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        data += 4;
+    }
+    for (; data < end; data++) {
+        h ^= (*data) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t ngraph::DataHash::hash(const void* data, size_t size, uint64_t seed) {
+    DataHash hasher(seed);
+    hasher.update(data, size);
+    return hasher.digest();
+}
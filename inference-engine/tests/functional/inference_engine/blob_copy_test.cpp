@@ -463,3 +463,105 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopySetLayoutTest,
     ::testing::Combine(::testing::ValuesIn(BlobCopySetLayout_Dims),
                        ::testing::ValuesIn(BlobCopySetLayout_Precisions)));
 
+
+namespace {
+
+// element-by-element copy in the order of the destination, used as the baseline to compare 'blob_copy' with
+template <typename T>
+void referenceBlobCopy4D(const Blob::Ptr& srcBlob, Blob::Ptr& dstBlob) {
+    auto stridesOf = [] (const Blob::Ptr& blob) {
+        SizeVector strides = blob->getTensorDesc().getBlockingDesc().getStrides();
+        if (blob->getTensorDesc().getLayout() == NHWC) {
+            return SizeVector{strides[0], strides[3], strides[1], strides[2]};
+        }
+        return strides;
+    };
+    const auto srcStrides = stridesOf(srcBlob);
+    const auto dstStrides = stridesOf(dstBlob);
+    const auto& dims = srcBlob->getTensorDesc().getDims();
+    auto srcData = srcBlob->buffer().as<const T*>();
+    auto dstData = dstBlob->buffer().as<T*>();
+    for (size_t n = 0; n < dims[0]; ++n) {
+        for (size_t c = 0; c < dims[1]; ++c) {
+            for (size_t h = 0; h < dims[2]; ++h) {
+                for (size_t w = 0; w < dims[3]; ++w) {
+                    dstData[n * dstStrides[0] + c * dstStrides[1] + h * dstStrides[2] + w * dstStrides[3]] =
+                        srcData[n * srcStrides[0] + c * srcStrides[1] + h * srcStrides[2] + w * srcStrides[3]];
+                }
+            }
+        }
+    }
+}
+
+void referenceBlobCopy4DWrapper(const Blob::Ptr& srcBlob, Blob::Ptr& dstBlob) {
+    switch (srcBlob->getTensorDesc().getPrecision()) {
+    case InferenceEngine::Precision::FP32:
+        return referenceBlobCopy4D<float>(srcBlob, dstBlob);
+    case InferenceEngine::Precision::U16:
+        return referenceBlobCopy4D<uint16_t>(srcBlob, dstBlob);
+    case InferenceEngine::Precision::U8:
+        return referenceBlobCopy4D<uint8_t>(srcBlob, dstBlob);
+    default:
+        THROW_IE_EXCEPTION << "Cant copy blob with \"" << srcBlob->getTensorDesc().getPrecision() << "\" precision\n";
+    }
+}
+
+template <typename F>
+int64_t MeasureMicros(F&& f, int iterations) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        f();
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count() / iterations;
+}
+
+std::vector<Dims> BlobCopyPerf_Dims = {
+    {{3, 1080, 1920}},
+    {{4, 720, 1280}},
+    {{64, 56, 56}},
+};
+
+std::vector<PrecisionType> BlobCopyPerf_Precisions = {
+    Precision::U8,
+    Precision::U16,
+    Precision::FP32,
+};
+
+}  // namespace
+
+using BlobCopyPerfTest = ::testing::TestWithParam<std::tuple<IsInterleaved, Dims, PrecisionType>>;
+
+// compares 'blob_copy' with the element-by-element baseline on frame-sized blobs;
+// correctness is covered by BlobCopyTest, so it runs only on request with --gtest_also_run_disabled_tests
+TEST_P(BlobCopyPerfTest, DISABLED_BlobCopyVsReference) {
+    const IsInterleaved srcIsInterleaved = get<0>(GetParam());
+    const Dims dims = get<1>(GetParam());
+    const Precision precision = get<2>(GetParam());
+    const SizeVector blobDims = SetDimVector(1, dims[0], {dims[1], dims[2]});
+
+    auto src = createBlob(precision, blobDims, setLayout(srcIsInterleaved, 2));
+    auto dst = createBlob(precision, blobDims, setLayout(!srcIsInterleaved, 2));
+    auto ref = createBlob(precision, blobDims, setLayout(!srcIsInterleaved, 2));
+    src->allocate();
+    dst->allocate();
+    ref->allocate();
+    FillBlob(src);
+
+    constexpr int iterations = 10;
+    blob_copy(src, dst);
+    referenceBlobCopy4DWrapper(src, ref);
+    auto blobCopyTime = MeasureMicros([&] {blob_copy(src, dst);}, iterations);
+    auto referenceTime = MeasureMicros([&] {referenceBlobCopy4DWrapper(src, ref);}, iterations);
+
+    PrintParams(src->getTensorDesc().getLayout(), blobDims, "src", precision);
+    std::cout << "Blob_copy execution time : " << blobCopyTime << " micros, "
+              << "reference execution time : " << referenceTime << " micros" << std::endl;
+
+    ASSERT_TRUE(IsEqualBlobCopy(ref, dst)) << "'blob_copy' function is not correct";
+}
+
+INSTANTIATE_TEST_CASE_P(performance, BlobCopyPerfTest,
+    ::testing::Combine(::testing::Values(true, false),
+                       ::testing::ValuesIn(BlobCopyPerf_Dims),
+                       ::testing::ValuesIn(BlobCopyPerf_Precisions)));
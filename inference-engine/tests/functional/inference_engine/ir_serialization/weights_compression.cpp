@@ -0,0 +1,151 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "ngraph/ngraph.hpp"
+#include "transformations/serialize.hpp"
+
+using namespace ngraph;
+
+class SerializationWeightsTest : public ::testing::Test {
+protected:
+    std::stringstream m_xml;
+    std::stringstream m_bin;
+    std::string m_bin_data;
+
+    void serialize(const std::shared_ptr<Function>& f, bool compressToFP16) {
+        pass::Serialize(m_xml, m_bin, pass::Serialize::Version::IR_V10, {}, compressToFP16).run_on_function(f);
+        m_bin_data = m_bin.str();
+    }
+
+    std::shared_ptr<Function> read() {
+        InferenceEngine::Core ie;
+        auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+            {InferenceEngine::Precision::U8, {m_bin_data.size()}, InferenceEngine::Layout::C},
+            reinterpret_cast<uint8_t*>(&m_bin_data[0]));
+        return ie.ReadNetwork(m_xml.str(), weights).getFunction();
+    }
+
+    static std::vector<float> values(size_t count, float first) {
+        std::vector<float> v(count);
+        for (size_t i = 0; i < count; i++) {
+            v[i] = first + 0.25f * i;
+        }
+        return v;
+    }
+};
+
+TEST_F(SerializationWeightsTest, IdenticalConstantsAreWrittenOnce) {
+    const Shape shape{2, 3};
+    auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+    auto a = opset1::Constant::create(element::f32, shape, values(6, 1.0f));
+    auto b = opset1::Constant::create(element::f32, shape, values(6, 1.0f));
+    auto c = opset1::Constant::create(element::f32, shape, values(6, 2.0f));
+    auto add = std::make_shared<opset1::Add>(std::make_shared<opset1::Add>(data, a),
+                                             std::make_shared<opset1::Multiply>(b, c));
+    auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{data});
+
+    serialize(f, false);
+    ASSERT_EQ(2 * 6 * sizeof(float), m_bin_data.size());
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(read(), f, true);
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_F(SerializationWeightsTest, FP32ConstantsAreCompressedToFP16) {
+    const Shape shape{10, 100};
+    const auto weights = values(shape_size(shape), -100.0f);
+    auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+    auto add = std::make_shared<opset1::Add>(data, opset1::Constant::create(element::f32, shape, weights));
+    auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{data});
+
+    serialize(f, true);
+    ASSERT_EQ(weights.size() * sizeof(float16), m_bin_data.size());
+
+    auto result = read();
+    auto result_add = result->get_results()[0]->get_input_node_shared_ptr(0);
+    auto convert = as_type_ptr<opset1::Convert>(result_add->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, convert);
+    ASSERT_EQ(element::f32, convert->get_output_element_type(0));
+    auto compressed = as_type_ptr<opset1::Constant>(convert->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, compressed);
+    ASSERT_EQ(element::f16, compressed->get_element_type());
+    const auto decompressed = compressed->cast_vector<float>();
+    for (size_t i = 0; i < weights.size(); i++) {
+        ASSERT_NEAR(weights[i], decompressed[i], 0.1f) << i;
+    }
+}
+
+TEST_F(SerializationWeightsTest, ConstantsOutOfFP16RangeAreNotCompressed) {
+    const Shape shape{3};
+    auto data = std::make_shared<opset1::Parameter>(element::f32, shape);
+    auto large = opset1::Constant::create(element::f32, shape, {1.0f, 1e6f, 2.0f});
+    auto small = opset1::Constant::create(element::f32, shape, {1.0f, 1e-9f, 2.0f});
+    auto add = std::make_shared<opset1::Add>(std::make_shared<opset1::Add>(data, large), small);
+    auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{data});
+
+    serialize(f, true);
+    ASSERT_EQ(2 * 3 * sizeof(float), m_bin_data.size());
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(read(), f, true);
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_F(SerializationWeightsTest, InterpolateScalesAreNotCompressed) {
+    // 300 * 0.1 is 30 in FP32, but 29.99 with the FP16 scale, so the compressed scale would change the shape
+    auto data = std::make_shared<opset4::Parameter>(element::f32, Shape{1, 3, 300, 300});
+    auto weights = opset4::Constant::create(element::f32, Shape{1, 3, 1, 1}, {0.5f, 0.25f, 2.0f});
+    auto sizes = opset4::Constant::create(element::i64, Shape{2}, {30, 30});
+    auto scales = opset4::Constant::create(element::f32, Shape{2}, {0.1f, 0.1f});
+    auto axes = opset4::Constant::create(element::i64, Shape{2}, {2, 3});
+    opset4::Interpolate::InterpolateAttrs attrs(opset4::Interpolate::InterpolateMode::nearest,
+                                                opset4::Interpolate::ShapeCalcMode::scales,
+                                                {0, 0, 0, 0}, {0, 0, 0, 0});
+    auto interpolate = std::make_shared<opset4::Interpolate>(std::make_shared<opset4::Multiply>(data, weights),
+                                                             sizes, scales, axes, attrs);
+    auto f = std::make_shared<Function>(NodeVector{interpolate}, ParameterVector{data});
+    ASSERT_EQ((Shape{1, 3, 30, 30}), f->get_output_shape(0));
+
+    serialize(f, true);
+    // the weights are compressed, the sizes, the scales and the axes are written as is
+    ASSERT_EQ(3 * sizeof(float16) + 2 * sizeof(int64_t) + 2 * sizeof(float) + 2 * sizeof(int64_t),
+              m_bin_data.size());
+
+    auto result = read();
+    ASSERT_EQ((Shape{1, 3, 30, 30}), result->get_output_shape(0));
+    auto result_interpolate = result->get_results()[0]->get_input_node_shared_ptr(0);
+    auto result_scales = as_type_ptr<opset4::Constant>(result_interpolate->get_input_node_shared_ptr(2));
+    ASSERT_NE(nullptr, result_scales);
+    ASSERT_EQ(element::f32, result_scales->get_element_type());
+    ASSERT_EQ(scales->cast_vector<float>(), result_scales->cast_vector<float>());
+    auto result_multiply = result_interpolate->get_input_node_shared_ptr(0);
+    ASSERT_NE(nullptr, as_type_ptr<opset4::Convert>(result_multiply->get_input_node_shared_ptr(1)));
+}
+
+TEST_F(SerializationWeightsTest, RangeInputsAreNotCompressed) {
+    // 30 / 0.1 is 300 elements in FP32, but 301 with the FP16 step
+    auto range = std::make_shared<opset4::Range>(opset4::Constant::create(element::f32, Shape{}, {0.0f}),
+                                                 opset4::Constant::create(element::f32, Shape{}, {30.0f}),
+                                                 opset4::Constant::create(element::f32, Shape{}, {0.1f}),
+                                                 element::f32);
+    auto data = std::make_shared<opset4::Parameter>(element::f32, Shape{300});
+    auto add = std::make_shared<opset4::Add>(data, range);
+    auto f = std::make_shared<Function>(NodeVector{add}, ParameterVector{data});
+
+    serialize(f, true);
+    ASSERT_EQ(3 * sizeof(float), m_bin_data.size());
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(read(), f, true);
+    ASSERT_TRUE(success) << message;
+}
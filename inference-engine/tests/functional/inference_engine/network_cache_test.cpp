@@ -0,0 +1,128 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <file_utils.h>
+#include "details/ie_so_loader.h"
+#include <cpp_interfaces/base/ie_executable_network_base.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
+#include <cpp_interfaces/impl/ie_plugin_internal.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+class CompiledNetwork : public ExecutableNetworkInternal {
+public:
+    IInferRequest::Ptr CreateInferRequest() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    void ExportImpl(std::ostream& networkModel) override {
+        networkModel << "compiled network" << std::endl;
+    }
+};
+
+// Counts compilations and imports, the plugin is reached through mock_engine
+class ImportExportPlugin : public InferencePluginInternal {
+public:
+    ExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const CNNNetwork&,
+                                                      const std::map<std::string, std::string>&) override {
+        loaded++;
+        return std::make_shared<CompiledNetwork>();
+    }
+
+    ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                        const std::map<std::string, std::string>&) override {
+        imported++;
+        std::getline(networkModel, importedModel);
+        auto impl = std::make_shared<CompiledNetwork>();
+        impl->SetPointerToPlugin(shared_from_this());
+        return make_executable_network(impl);
+    }
+
+    Parameter GetMetric(const std::string& name, const std::map<std::string, Parameter>&) const override {
+        if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+            return std::vector<std::string>{METRIC_KEY(IMPORT_EXPORT_SUPPORT)};
+        } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+            return true;
+        }
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+
+    int loaded = 0;
+    int imported = 0;
+    std::string importedModel;
+};
+
+}  // namespace
+
+class NetworkCacheTests : public ::testing::Test {
+protected:
+    std::string cacheDir = ::testing::UnitTest::GetInstance()->current_test_info()->name() + std::string("_cache");
+    std::shared_ptr<ImportExportPlugin> plugin = std::make_shared<ImportExportPlugin>();
+    std::unique_ptr<details::SharedObjectLoader> mockEngine;
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    Core createCore() {
+        mockEngine.reset(new details::SharedObjectLoader(FileUtils::makePluginLibraryName<char>(
+            getIELibraryPath(), std::string("mock_engine") + IE_BUILD_POSTFIX).c_str()));
+        // the next plugin created from mock_engine forwards calls to the injected one
+        auto injectProxyEngine = reinterpret_cast<void (*)(IInferencePlugin*)>(
+            mockEngine->get_symbol("InjectProxyEngine"));
+        injectProxyEngine(plugin.get());
+
+        Core ie;
+        ie.RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, "MOCK");
+        ie.SetConfig({{CONFIG_KEY(NETWORK_CACHE_DIR), cacheDir}});
+        return ie;
+    }
+};
+
+TEST_F(NetworkCacheTests, storedNetworkIsImportedInsteadOfCompiled) {
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    {
+        auto ie = createCore();
+        ASSERT_NO_THROW(ie.LoadNetwork(network, "MOCK"));
+        ASSERT_EQ(1, plugin->loaded);
+        ASSERT_EQ(0, plugin->imported);
+        ASSERT_TRUE(CommonTestUtils::directoryExists(cacheDir));
+
+        ASSERT_NO_THROW(ie.LoadNetwork(network, "MOCK"));
+        ASSERT_EQ(1, plugin->loaded) << "Cached network was compiled again";
+        ASSERT_EQ(1, plugin->imported);
+        ASSERT_EQ("compiled network", plugin->importedModel);
+    }
+
+    // the cache outlives the Core, e.g. the next run of an application imports the network as well
+    auto ie = createCore();
+    ASSERT_NO_THROW(ie.LoadNetwork(network, "MOCK"));
+    ASSERT_EQ(1, plugin->loaded) << "Cached network was compiled again";
+    ASSERT_EQ(2, plugin->imported);
+}
+
+TEST_F(NetworkCacheTests, changedNetworkIsCompiled) {
+    auto ie = createCore();
+    ASSERT_NO_THROW(ie.LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu()), "MOCK"));
+    ASSERT_NO_THROW(ie.LoadNetwork(CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu({1, 1, 16, 32})), "MOCK"));
+    ASSERT_EQ(2, plugin->loaded);
+    ASSERT_EQ(0, plugin->imported);
+}
@@ -2,6 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
 #include <string>
 #include <legacy/ie_util_internal.hpp>
 #include "ngraph_reader_tests.hpp"
@@ -53,3 +57,137 @@ TEST_F(NGraphReaderTests, ReadConstantNetwork) {
 
         IE_SUPPRESS_DEPRECATED_END
 }
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkSharesWeights) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="constant" type="Const" version="opset1">
+            <data element_type="f32" offset="16" shape="1,3,2,2" size="48"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>2</dim>
+                    <dim>2</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    Core ie;
+    Blob::Ptr weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {64}, Layout::C));
+    weights->allocate();
+    auto weightsData = weights->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < weights->size(); i++) {
+        weightsData[i] = static_cast<uint8_t>(i);
+    }
+
+    auto network = ie.ReadNetwork(model, weights);
+    std::shared_ptr<ngraph::op::Constant> constant;
+    for (const auto& op : network.getFunction()->get_ops()) {
+        if (auto node = std::dynamic_pointer_cast<ngraph::op::Constant>(op))
+            constant = node;
+    }
+    ASSERT_NE(nullptr, constant);
+    ASSERT_EQ(weightsData + 16, constant->get_data_ptr());
+
+    // constant keeps weights alive
+    weights.reset();
+    ASSERT_EQ(16, *constant->get_data_ptr<uint8_t>());
+}
+
+TEST_F(NGraphReaderTests, ReadConstantNetworkWithMappedWeights) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="aligned" type="Const" version="opset1">
+            <data element_type="f32" offset="16" shape="4" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="unaligned" type="Const" version="opset1">
+            <data element_type="f32" offset="34" shape="4" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output_aligned" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+        <layer name="output_unaligned" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const std::vector<float> alignedValues{1.5f, -2.f, 3.25f, 4.f};
+    const std::vector<float> unalignedValues{-5.f, 6.5f, 7.f, -8.75f};
+    std::string weights(64, '\0');
+    std::memcpy(&weights[16], alignedValues.data(), alignedValues.size() * sizeof(float));
+    std::memcpy(&weights[34], unalignedValues.data(), unalignedValues.size() * sizeof(float));
+
+    const std::string modelPath = "ReadConstantNetworkWithMappedWeights.xml";
+    const std::string weightsPath = "ReadConstantNetworkWithMappedWeights.bin";
+    CommonTestUtils::createFile(modelPath, model);
+    {
+        std::ofstream weightsFile(weightsPath, std::ios::binary);
+        weightsFile.write(weights.data(), weights.size());
+    }
+
+    {
+        // the weights file is mapped when the network is read from the files
+        Core ie;
+        auto network = ie.ReadNetwork(modelPath, weightsPath);
+
+        std::map<std::string, std::shared_ptr<ngraph::op::Constant>> constants;
+        for (const auto& op : network.getFunction()->get_ops()) {
+            if (auto node = std::dynamic_pointer_cast<ngraph::op::Constant>(op))
+                constants[node->get_friendly_name()] = node;
+        }
+        EXPECT_EQ(2, constants.size());
+        for (auto&& expected : {std::make_pair("aligned", alignedValues), std::make_pair("unaligned", unalignedValues)}) {
+            auto constant = constants[expected.first];
+            if (constant == nullptr)
+                continue;
+            // data at an unaligned offset is copied, so the constant data is always aligned to the element type
+            EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(constant->get_data_ptr()) % sizeof(float)) << expected.first;
+            EXPECT_EQ(expected.second, constant->cast_vector<float>()) << expected.first;
+        }
+    }
+    // the mapping is released with the network, so the files can be removed on any OS
+    CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <transformations/utils/data_hash.hpp>
+
+TEST(DataHashTests, MatchesReferenceXXHash64) {
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, ngraph::DataHash::hash("", 0));
+    ASSERT_EQ(0x44BC2CF5AD770999ULL, ngraph::DataHash::hash("abc", 3));
+}
+
+TEST(DataHashTests, DigestDoesNotDependOnUpdateSizes) {
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    for (size_t size : {0, 7, 31, 32, 33, 100, 1000}) {
+        const uint64_t expected = ngraph::DataHash::hash(data.data(), size);
+        for (size_t step : {1, 5, 32, 33}) {
+            ngraph::DataHash hasher;
+            for (size_t offset = 0; offset < size; offset += step) {
+                hasher.update(data.data() + offset, std::min(step, size - offset));
+            }
+            ASSERT_EQ(expected, hasher.digest()) << "size " << size << ", step " << step;
+        }
+    }
+    ASSERT_NE(ngraph::DataHash::hash(data.data(), 100), ngraph::DataHash::hash(data.data(), 100, 1));
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_common.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/common_optimizations.hpp>
+#include <transformations/opset_conversions/convert_opset3_to_opset2.hpp>
+#include <transformations/opset_conversions/convert_opset2_to_opset1.hpp>
+#include <transformations/init_node_info.hpp>
+#include <legacy/transformations/convert_opset1_to_legacy/convert_opset1_to_legacy.hpp>
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+
+// Chain of convolution blocks with a bias, an activation and a per-channel scale and shift,
+// so that most of the passes of the pipelines find something to fuse in every block
+std::shared_ptr<Function> makeLargeFunction(size_t numBlocks) {
+    const size_t channels = 8;
+    auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{1, channels, 14, 14});
+    Output<Node> last = input;
+    for (size_t i = 0; i < numBlocks; i++) {
+        auto weights = opset1::Constant::create(element::f32, Shape{channels, channels, 3, 3}, {0.01f});
+        auto conv = std::make_shared<opset1::Convolution>(last, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                          CoordinateDiff{1, 1}, Strides{1, 1});
+        auto bias = opset1::Constant::create(element::f32, Shape{1, channels, 1, 1}, {0.1f});
+        auto relu = std::make_shared<opset1::Relu>(std::make_shared<opset1::Add>(conv, bias));
+        auto scale = opset1::Constant::create(element::f32, Shape{1, channels, 1, 1}, {0.5f});
+        auto shift = opset1::Constant::create(element::f32, Shape{1, channels, 1, 1}, {0.2f});
+        last = std::make_shared<opset1::Add>(std::make_shared<opset1::Multiply>(relu, scale), shift);
+    }
+    return std::make_shared<Function>(NodeVector{last.get_node_shared_ptr()}, ParameterVector{input});
+}
+
+double MeasureMillis(pass::Manager& manager, const std::shared_ptr<Function>& f) {
+    auto start = std::chrono::high_resolution_clock::now();
+    manager.run_passes(f);
+    auto finish = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+const size_t numBlocks = 2000;
+
+}  // namespace
+
+// Benchmarks of the pipelines on a large model, graph bookkeeping shouldn't dominate the reported time.
+// They only report timings, so they are disabled and run with --gtest_also_run_disabled_tests
+TEST(TransformationsPipelinePerfTest, DISABLED_CommonOptimizations) {
+    auto f = makeLargeFunction(numBlocks);
+    pass::Manager manager;
+    manager.register_pass<pass::InitNodeInfo>();
+    manager.register_pass<pass::CommonOptimizations>();
+    const auto millis = MeasureMillis(manager, f);
+    std::cout << "CommonOptimizations on " << f->get_ordered_ops().size() << " nodes: " << millis << " ms" << std::endl;
+    ASSERT_EQ(f->get_output_shape(0), (Shape{1, 8, 14, 14}));
+}
+
+TEST(TransformationsPipelinePerfTest, DISABLED_PluginPipeline) {
+    auto f = makeLargeFunction(numBlocks);
+    pass::Manager manager;
+    manager.register_pass<pass::InitNodeInfo>();
+    manager.register_pass<pass::CommonOptimizations>();
+    manager.register_pass<pass::ConvertOpSet3ToOpSet2>();
+    manager.register_pass<pass::ConvertOpSet2ToOpSet1>();
+    manager.register_pass<pass::ConvertOpSet1ToLegacy>();
+    const auto millis = MeasureMillis(manager, f);
+    std::cout << "Plugin pipeline on " << f->get_ordered_ops().size() << " nodes: " << millis << " ms" << std::endl;
+    ASSERT_EQ(f->get_output_shape(0), (Shape{1, 8, 14, 14}));
+}
@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class NetworkCacheTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::shared_ptr<ngraph::Function> function;
+    std::string cache_path;
+
+    void SetUp() override {
+        function = ngraph::builder::subgraph::makeConvPoolRelu();
+        cache_path = test_name + "_cache";
+    }
+};
+
+TEST_F(NetworkCacheTest, CpuNetworksAreNotCached) {
+    InferenceEngine::Core ie;
+    ie.SetConfig({{ CONFIG_KEY(NETWORK_CACHE_DIR), cache_path }});
+    InferenceEngine::CNNNetwork cnnNet(function);
+
+    // CPU compiles exported networks again on import, so caching them gives no benefit
+    std::vector<std::string> supportedMetrics = ie.GetMetric("CPU", METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_EQ(std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT)),
+              supportedMetrics.end());
+
+    auto execNet = ie.LoadNetwork(cnnNet, "CPU");
+    auto request = execNet.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_FALSE(CommonTestUtils::directoryExists(cache_path)) << "CPU network was cached";
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "import_export_tests/import_reshape_permute_conv.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+        InferenceEngine::Precision::FP32,
+};
+
+const std::vector<std::map<std::string, std::string>> exportConfigs = {
+    {},
+    {
+        {"CPU_THROUGHPUT_STREAMS", "2"}
+    }
+};
+
+const std::vector<std::map<std::string, std::string>> importConfigs = {
+    {},
+    {
+        {"CPU_THROUGHPUT_STREAMS", "1"}
+    }
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportNetworkCase, ImportReshapePermuteConv,
+                        ::testing::Combine(
+                            ::testing::ValuesIn(netPrecisions),
+                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                            ::testing::ValuesIn(exportConfigs),
+                            ::testing::ValuesIn(importConfigs)),
+                        ImportReshapePermuteConv::getTestCaseName);
+
+} // namespace
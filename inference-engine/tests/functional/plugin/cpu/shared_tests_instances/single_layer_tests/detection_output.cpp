@@ -45,7 +45,11 @@ const std::vector<ParamsWhichSizeDepends> specificParams3In = {
     ParamsWhichSizeDepends{true, true, false, 10, 10, {1, 60}, {1, 165}, {1, 1, 75}, {}, {}},
     ParamsWhichSizeDepends{true, false, false, 10, 10, {1, 660}, {1, 165}, {1, 1, 75}, {}, {}},
     ParamsWhichSizeDepends{false, true, false, 10, 10, {1, 60}, {1, 165}, {1, 2, 75}, {}, {}},
-    ParamsWhichSizeDepends{false, false, false, 10, 10, {1, 660}, {1, 165}, {1, 2, 75}, {}, {}}
+    ParamsWhichSizeDepends{false, false, false, 10, 10, {1, 660}, {1, 165}, {1, 2, 75}, {}, {}},
+
+    // priors number is not a multiple of the blocks used in the implementation
+    ParamsWhichSizeDepends{false, true, true, 1, 1, {1, 600}, {1, 1650}, {1, 2, 600}, {}, {}},
+    ParamsWhichSizeDepends{true, false, false, 10, 10, {1, 6600}, {1, 1650}, {1, 1, 750}, {}, {}}
 };
 
 const auto params3Inputs = ::testing::Combine(
@@ -0,0 +1,142 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <blob_factory.hpp>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class OutputProducer {
+    Convolution,    // the output is written by a regular node
+    Reshape,        // the output is an in-place view on the convolution output
+    Concat          // convolutions write directly into parts of the output
+};
+
+typedef std::tuple<
+        std::vector<size_t>,     // Input shape
+        OutputProducer           // Node producing network output
+> OutputZeroCopyTuple;
+
+/*  Output blobs set by user are filled by producers of network outputs directly. Outputs of the request
+ *  are checked against references, then one more request sharing the same graph is inferred with another
+ *  input to check that it does not write to the blobs of the first request.
+ */
+class OutputZeroCopyTest : public testing::WithParamInterface<OutputZeroCopyTuple>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<OutputZeroCopyTuple> &obj) {
+        std::vector<size_t> inputShape;
+        OutputProducer producer;
+        std::tie(inputShape, producer) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        switch (producer) {
+            case OutputProducer::Convolution: results << "Producer=Convolution"; break;
+            case OutputProducer::Reshape: results << "Producer=Reshape"; break;
+            case OutputProducer::Concat: results << "Producer=Concat"; break;
+        }
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        OutputProducer producer;
+        std::tie(inputShape, producer) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto makeConv = [&]() {
+            return ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                    ngraph::op::PadType::EXPLICIT, inputShape[1]);
+        };
+
+        std::shared_ptr<ngraph::Node> output = makeConv();
+        if (producer == OutputProducer::Reshape) {
+            std::vector<size_t> flatShape = {inputShape[0], ngraph::shape_size(inputShape) / inputShape[0]};
+            auto shape = ngraph::builder::makeConstant(ngraph::element::i64, {flatShape.size()}, flatShape);
+            output = std::make_shared<ngraph::opset1::Reshape>(output, shape, false);
+        } else if (producer == OutputProducer::Concat) {
+            output = ngraph::builder::makeConcat({output, makeConv()}, 1);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, params, "output_zero_copy");
+    }
+
+    void Infer() override {
+        inferRequest = executableNetwork.CreateInferRequest();
+        auto otherRequest = executableNetwork.CreateInferRequest();
+        inputs.clear();
+
+        for (const auto &input : executableNetwork.GetInputsInfo()) {
+            const auto &info = input.second;
+            auto blob = GenerateInput(*info);
+            inferRequest.SetBlob(info->name(), blob);
+            inputs.push_back(blob);
+            otherRequest.SetBlob(info->name(), FuncTestUtils::createAndFillBlob(info->getTensorDesc(), 10, 20));
+        }
+
+        std::vector<InferenceEngine::Blob::Ptr> userOutputs;
+        for (const auto &output : executableNetwork.GetOutputsInfo()) {
+            auto blob = make_blob_with_precision(inferRequest.GetBlob(output.first)->getTensorDesc());
+            blob->allocate();
+            inferRequest.SetBlob(output.first, blob);
+            userOutputs.push_back(blob);
+        }
+        inferRequest.Infer();
+
+        std::vector<std::vector<uint8_t>> expectedOutputs;
+        for (const auto &blob : userOutputs) {
+            auto data = blob->cbuffer().as<const uint8_t *>();
+            expectedOutputs.emplace_back(data, data + blob->byteSize());
+        }
+
+        otherRequest.Infer();
+
+        for (size_t i = 0; i < userOutputs.size(); i++) {
+            ASSERT_EQ(0, std::memcmp(expectedOutputs[i].data(), userOutputs[i]->cbuffer().as<const uint8_t *>(),
+                                     expectedOutputs[i].size()));
+        }
+    }
+};
+
+TEST_P(OutputZeroCopyTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 3, 7, 9}
+};
+
+const std::vector<OutputProducer> producers = {
+        OutputProducer::Convolution,
+        OutputProducer::Reshape,
+        OutputProducer::Concat
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_OutputZeroCopy, OutputZeroCopyTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::ValuesIn(producers)),
+                        OutputZeroCopyTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using ngraph::helpers::ActivationTypes;
+using ngraph::helpers::EltwiseTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,                     // Input shape
+        size_t,                                  // Number of branches
+        std::map<std::string, std::string>       // Plugin configuration
+> ParallelBranchesTuple;
+
+/*  Inception-like block: branches of different depth are concatenated, the first and the last branches
+ *  are also summed into the second output. Each branch depth is equal to its index + 1.
+ *
+ *                    Parameter
+ *        ____________/   |    \____________
+ *   Conv 1x1        Conv 3x3  ...     Conv 3x3
+ *       |              |                 |
+ *       |           Conv 3x3   ...      ...
+ *        \_________  |  _______________/ |
+ *                  Concat              Add (with the first branch)
+ *                    |                   |
+ *                  Result              Result
+ */
+class ParallelBranchesTest : public testing::WithParamInterface<ParallelBranchesTuple>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelBranchesTuple> &obj) {
+        std::vector<size_t> inputShape;
+        size_t branchesNum;
+        std::map<std::string, std::string> config;
+        std::tie(inputShape, branchesNum, config) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Branches=" << branchesNum;
+        for (auto &item : config) {
+            results << "_" << item.first << "=" << item.second;
+        }
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        size_t branchesNum;
+        std::tie(inputShape, branchesNum, configuration) = this->GetParam();
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+
+        ngraph::OutputVector branches;
+        for (size_t branch = 0; branch < branchesNum; branch++) {
+            const size_t kernel = branch == 0 ? 1 : 3;
+            const ptrdiff_t pad = branch == 0 ? 0 : 1;
+            ngraph::Output<ngraph::Node> out = params[0];
+            for (size_t depth = 0; depth <= branch; depth++) {
+                out = ngraph::builder::makeConvolution(out, ngraph::element::f32, {kernel, kernel}, {1, 1}, {pad, pad},
+                                                       {pad, pad}, {1, 1}, ngraph::op::PadType::EXPLICIT, inputShape[1]);
+                out = ngraph::builder::makeActivation(out, ngraph::element::f32,
+                                                      depth % 2 ? ActivationTypes::Sigmoid : ActivationTypes::Relu);
+            }
+            branches.push_back(out);
+        }
+
+        auto concat = ngraph::builder::makeConcat(branches, 1);
+        auto add = ngraph::builder::makeEltwise(branches.front(), branches.back(), EltwiseTypes::ADD);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat),
+                                     std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, params, "parallel_branches");
+    }
+};
+
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 16, 7, 9}
+};
+
+const std::vector<size_t> branchesNum = {2, 4};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::YES}},
+        {{InferenceEngine::PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, InferenceEngine::PluginConfigParams::YES},
+         {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ParallelBranches, ParallelBranchesTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::ValuesIn(branchesNum),
+                                ::testing::ValuesIn(configs)),
+                        ParallelBranchesTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
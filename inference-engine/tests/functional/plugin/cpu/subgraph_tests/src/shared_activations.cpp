@@ -0,0 +1,134 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using ngraph::helpers::ActivationTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,     // Input shape
+        std::string              // Number of streams
+> SharedActivationsTuple;
+
+/*  Intermediate data of the networks are placed into memory leased from the process-wide arena.
+ *  Requests of two networks of different size are inferred at once, so the networks lease
+ *  different blocks from one inference to another.
+ *
+ *      Parameter -> Conv + ReLU -> Conv + Sigmoid -> ... -> Result
+ */
+class SharedActivationsTest : public testing::WithParamInterface<SharedActivationsTuple>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SharedActivationsTuple> &obj) {
+        std::vector<size_t> inputShape;
+        std::string streams;
+        std::tie(inputShape, streams) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Streams=" << streams;
+        return results.str();
+    }
+
+protected:
+    static std::shared_ptr<ngraph::Function> makeFunction(const std::vector<size_t> &inputShape, size_t depth) {
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        ngraph::Output<ngraph::Node> out = params[0];
+        for (size_t i = 0; i < depth; i++) {
+            out = ngraph::builder::makeConvolution(out, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                   ngraph::op::PadType::EXPLICIT, inputShape[1] * (i % 2 + 1));
+            out = ngraph::builder::makeActivation(out, ngraph::element::f32,
+                                                  i % 2 ? ActivationTypes::Sigmoid : ActivationTypes::Relu);
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(out)};
+        return std::make_shared<ngraph::Function>(results, params, "shared_activations");
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::string streams;
+        std::tie(inputShape, streams) = this->GetParam();
+        configuration[InferenceEngine::PluginConfigParams::KEY_CPU_SHARED_ACTIVATIONS] =
+                InferenceEngine::PluginConfigParams::YES;
+        configuration[InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = streams;
+
+        function = makeFunction(inputShape, 4);
+    }
+
+    void Infer() override {
+        LayerTestsCommon::Infer();
+
+        auto largerShape = inputShape;
+        largerShape[2] *= 2;
+        InferenceEngine::CNNNetwork largerNetwork(makeFunction(largerShape, 6));
+        auto largerExecNetwork = core->LoadNetwork(largerNetwork, targetDevice, configuration);
+
+        std::vector<InferenceEngine::InferRequest> requests, largerRequests;
+        for (size_t i = 0; i < 4; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            for (const auto &input : executableNetwork.GetInputsInfo()) {
+                requests.back().SetBlob(input.first, inferRequest.GetBlob(input.first));
+            }
+            largerRequests.push_back(largerExecNetwork.CreateInferRequest());
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            largerRequests[i].StartAsync();
+            requests[i].StartAsync();
+        }
+        for (auto &request : largerRequests) {
+            request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+        }
+        for (auto &request : requests) {
+            request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+            for (const auto &output : executableNetwork.GetOutputsInfo()) {
+                auto expected = inferRequest.GetBlob(output.first);
+                auto actual = request.GetBlob(output.first);
+                ASSERT_EQ(expected->byteSize(), actual->byteSize());
+                ASSERT_EQ(0, std::memcmp(expected->cbuffer().as<const uint8_t *>(), actual->cbuffer().as<const uint8_t *>(),
+                                         expected->byteSize()));
+            }
+        }
+
+        // the request of the reference check is inferred again after the other network
+        LayerTestsCommon::Infer();
+    }
+
+    std::vector<size_t> inputShape;
+};
+
+TEST_P(SharedActivationsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 4, 7, 9}
+};
+
+const std::vector<std::string> streams = {"1", "2"};
+
+INSTANTIATE_TEST_CASE_P(smoke_SharedActivations, SharedActivationsTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::ValuesIn(streams)),
+                        SharedActivationsTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
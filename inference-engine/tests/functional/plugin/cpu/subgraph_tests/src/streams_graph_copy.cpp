@@ -0,0 +1,114 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ie_plugin_config.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using ngraph::helpers::ActivationTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,     // Input shape
+        std::string              // Number of streams
+> StreamsGraphCopyTuple;
+
+/*  Graphs of the streams are copied from the graph compiled once. The network contains fused nodes
+ *  and a node implemented by an extension, several requests are inferred at once to run all streams.
+ *
+ *      Parameter -> Conv + ReLU -> ShuffleChannels -> Conv + Sigmoid -> Result
+ */
+class StreamsGraphCopyTest : public testing::WithParamInterface<StreamsGraphCopyTuple>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StreamsGraphCopyTuple> &obj) {
+        std::vector<size_t> inputShape;
+        std::string streams;
+        std::tie(inputShape, streams) = obj.param;
+
+        std::ostringstream results;
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "Streams=" << streams;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        std::string streams;
+        std::tie(inputShape, streams) = this->GetParam();
+        configuration[InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = streams;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, inputShape[1]);
+        auto relu = ngraph::builder::makeActivation(conv1, ngraph::element::f32, ActivationTypes::Relu);
+        auto shuffle = ngraph::builder::makeShuffleChannels(relu, 1, 2);
+        auto conv2 = ngraph::builder::makeConvolution(shuffle, ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, inputShape[1]);
+        auto sigmoid = ngraph::builder::makeActivation(conv2, ngraph::element::f32, ActivationTypes::Sigmoid);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(sigmoid)};
+        function = std::make_shared<ngraph::Function>(results, params, "streams_graph_copy");
+    }
+
+    void Infer() override {
+        LayerTestsCommon::Infer();
+
+        std::vector<InferenceEngine::InferRequest> requests;
+        for (size_t i = 0; i < 8; i++) {
+            requests.push_back(executableNetwork.CreateInferRequest());
+            for (const auto &input : executableNetwork.GetInputsInfo()) {
+                requests.back().SetBlob(input.first, inferRequest.GetBlob(input.first));
+            }
+        }
+        for (auto &request : requests) {
+            request.StartAsync();
+        }
+        for (auto &request : requests) {
+            request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+            for (const auto &output : executableNetwork.GetOutputsInfo()) {
+                auto expected = inferRequest.GetBlob(output.first);
+                auto actual = request.GetBlob(output.first);
+                ASSERT_EQ(expected->byteSize(), actual->byteSize());
+                ASSERT_EQ(0, std::memcmp(expected->cbuffer().as<const uint8_t *>(), actual->cbuffer().as<const uint8_t *>(),
+                                         expected->byteSize()));
+            }
+        }
+    }
+};
+
+TEST_P(StreamsGraphCopyTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 8, 16, 16},
+        {2, 4, 7, 9}
+};
+
+const std::vector<std::string> streams = {"2", "4"};
+
+INSTANTIATE_TEST_CASE_P(smoke_StreamsGraphCopy, StreamsGraphCopyTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::ValuesIn(streams)),
+                        StreamsGraphCopyTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        size_t,     // Number of iterations
+        int64_t     // Stride of sliced input and concatenated output
+> TensorIteratorRebindingTuple;
+
+/*  TensorIterator rebinds body memory to chunks of sliced inputs and concatenated outputs and swaps buffers of
+ *  back edges instead of copying the data. The same body with in-place Reshapes around the computations can't be
+ *  rebound, so its ports are copied. Both networks are inferred several times with different inputs on the same
+ *  requests, their outputs have to be equal after each run, the last run is also checked against references.
+ *  Body: y = x - s, s' = 0.5 * s + x, x is sliced along axis 1, s' is passed to s by the back edge.
+ */
+class TensorIteratorRebindingTest : public testing::WithParamInterface<TensorIteratorRebindingTuple>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorRebindingTuple> &obj) {
+        size_t iterations;
+        int64_t stride;
+        std::tie(iterations, stride) = obj.param;
+
+        std::ostringstream results;
+        results << "Iterations=" << iterations << "_";
+        results << "Stride=" << stride;
+        return results.str();
+    }
+
+protected:
+    std::shared_ptr<ngraph::Function> makeFunction(bool copiedPorts) const {
+        const auto elementShape = ngraph::Shape{1, 1, hiddenSize};
+        auto outerParams = ngraph::builder::makeParams(ngraph::element::f32, {{1, iterations, hiddenSize}, elementShape});
+        auto bodyParams = ngraph::builder::makeParams(ngraph::element::f32, {elementShape, elementShape});
+
+        auto reshape = [](const ngraph::Output<ngraph::Node> &input, const std::vector<size_t> &shape) {
+            auto pattern = ngraph::builder::makeConstant(ngraph::element::i64, {shape.size()}, shape);
+            return std::make_shared<ngraph::opset5::Reshape>(input, pattern, false);
+        };
+
+        ngraph::Output<ngraph::Node> x = bodyParams[0], s = bodyParams[1];
+        if (copiedPorts) {
+            x = reshape(x, {1, hiddenSize});
+            s = reshape(s, {1, hiddenSize});
+        }
+        ngraph::Output<ngraph::Node> y = std::make_shared<ngraph::opset5::Subtract>(x, s);
+        auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1}, {0.5f});
+        ngraph::Output<ngraph::Node> state = std::make_shared<ngraph::opset5::Add>(
+                std::make_shared<ngraph::opset5::Multiply>(s, scale), x);
+        if (copiedPorts) {
+            y = reshape(y, elementShape);
+            state = reshape(state, elementShape);
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset5::Result>(y),
+                                     std::make_shared<ngraph::opset5::Result>(state)};
+        auto tensorIterator = std::make_shared<ngraph::opset5::TensorIterator>();
+        tensorIterator->set_function(std::make_shared<ngraph::Function>(results, bodyParams, "body"));
+
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        tensorIterator->set_sliced_input(bodyParams[0], outerParams[0], start, stride, 1, end, 1);
+        tensorIterator->set_merged_input(bodyParams[1], outerParams[1], results[1]);
+        tensorIterator->get_concatenated_slices(results[0], start, stride, 1, end, 1);
+        tensorIterator->get_iter_value(results[1]);
+
+        return std::make_shared<ngraph::Function>(ngraph::OutputVector{tensorIterator->output(0), tensorIterator->output(1)},
+                                                  outerParams, copiedPorts ? "ti_copied_ports" : "ti_rebound_ports");
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::tie(iterations, stride) = this->GetParam();
+
+        function = makeFunction(false);
+    }
+
+    void Infer() override {
+        auto copiedNetwork = core->LoadNetwork(InferenceEngine::CNNNetwork{makeFunction(true)}, targetDevice, configuration);
+        auto copiedRequest = copiedNetwork.CreateInferRequest();
+        inferRequest = executableNetwork.CreateInferRequest();
+
+        // an odd number of iterations leaves back edge buffers swapped for the next run
+        for (int run = 1; run <= 3; run++) {
+            inputs.clear();
+            for (const auto &input : executableNetwork.GetInputsInfo()) {
+                const auto &info = input.second;
+                auto blob = FuncTestUtils::createAndFillBlob(info->getTensorDesc(), 10, -5, 1000, run);
+                inferRequest.SetBlob(info->name(), blob);
+                copiedRequest.SetBlob(info->name(), blob);
+                inputs.push_back(blob);
+            }
+            inferRequest.Infer();
+            copiedRequest.Infer();
+
+            for (const auto &output : executableNetwork.GetOutputsInfo()) {
+                Compare(copiedRequest.GetBlob(output.first), inferRequest.GetBlob(output.first));
+            }
+        }
+    }
+
+    size_t iterations;
+    int64_t stride;
+    const size_t hiddenSize = 16;
+};
+
+TEST_P(TensorIteratorRebindingTest, CompareWithCopiedPorts) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<size_t> iterations = {3, 4};
+
+const std::vector<int64_t> strides = {1, -1};
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorRebinding, TensorIteratorRebindingTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(iterations),
+                                ::testing::ValuesIn(strides)),
+                        TensorIteratorRebindingTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -176,7 +176,8 @@ namespace BehaviorTestsDefinitions {
             } else if (targetDevice == CommonTestUtils::DEVICE_MULTI) {
             } else {
                 ASSERT_EQ(0u, InferenceEngine::ExecutorManager::getInstance()->getExecutorsNumber());
-                ASSERT_GE(2u, InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutorsNumber());
+                // task, callback and CPU pre-processing executors
+                ASSERT_GE(3u, InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutorsNumber());
             }
         }
         if (targetDevice == CommonTestUtils::DEVICE_CPU) {
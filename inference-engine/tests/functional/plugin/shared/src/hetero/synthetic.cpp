@@ -11,7 +11,24 @@
 #include <random>
 namespace HeteroTests {
 
+// Heads hanging off the shared backbone do not depend on each other, so their subgraphs may be inferred concurrently
+static std::shared_ptr<ngraph::Function> makeMultipleHeads() {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 4, 20, 20}});
+    auto backbone = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 5);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(backbone);
+    ngraph::ResultVector results;
+    for (std::size_t kernel : {1, 3}) {
+        std::ptrdiff_t pad = kernel / 2;
+        auto head = ngraph::builder::makeConvolution(relu, ngraph::element::f32, {kernel, kernel}, {1, 1}, {pad, pad},
+                                                     {pad, pad}, {1, 1}, ngraph::op::PadType::EXPLICIT, 5);
+        results.push_back(std::make_shared<ngraph::opset1::Result>(std::make_shared<ngraph::opset1::Sigmoid>(head)));
+    }
+    return std::make_shared<ngraph::Function>(results, params, "MultipleHeads");
+}
+
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
+    [] {return makeMultipleHeads();},
     [] {return ngraph::builder::subgraph::makeSplitMultiConvConcat();},
     [] {return ngraph::builder::subgraph::makeNestedSplitConvConcat();},
     [] {return ngraph::builder::subgraph::makeSplitConvConcatNestedInBranch();},
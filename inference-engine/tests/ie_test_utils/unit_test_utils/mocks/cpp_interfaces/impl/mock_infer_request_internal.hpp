@@ -21,6 +21,8 @@ public:
     using InferRequestInternal::SetBlob;
     using InferRequestInternal::GetBlob;
     MOCK_METHOD0(InferImpl, void());
+    MOCK_METHOD0(Preprocess, void());
+    MOCK_CONST_METHOD0(isPreprocessingRequired, bool());
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngineProfileInfo> &));
     MOCK_METHOD0(Cancel, InferenceEngine::StatusCode());
 };
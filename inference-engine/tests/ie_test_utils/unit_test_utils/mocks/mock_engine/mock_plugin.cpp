@@ -38,6 +38,26 @@ MockPlugin::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork& network,
     return {};
 }
 
+ExecutableNetwork
+MockPlugin::ImportNetwork(std::istream& networkModel,
+                          const std::map<std::string, std::string>& config) {
+    if (_target) {
+        return _target->ImportNetwork(networkModel, config);
+    } else {
+        return InferencePluginInternal::ImportNetwork(networkModel, config);
+    }
+}
+
+Parameter
+MockPlugin::GetMetric(const std::string& name,
+                      const std::map<std::string, Parameter>& options) const {
+    if (_target) {
+        return _target->GetMetric(name, options);
+    } else {
+        return InferencePluginInternal::GetMetric(name, options);
+    }
+}
+
 InferenceEngine::IInferencePlugin *__target = nullptr;
 
 INFERENCE_PLUGIN_API(StatusCode) CreatePluginEngine(IInferencePlugin *&plugin, ResponseDesc *resp) noexcept {
@@ -23,6 +23,13 @@ public:
     InferenceEngine::ExecutableNetworkInternal::Ptr
     LoadExeNetworkImpl(const InferenceEngine::CNNNetwork& network,
                        const std::map<std::string, std::string>& config) override;
+    using InferenceEngine::InferencePluginInternal::ImportNetwork;
+    InferenceEngine::ExecutableNetwork
+    ImportNetwork(std::istream& networkModel,
+                  const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter
+    GetMetric(const std::string& name,
+              const std::map<std::string, InferenceEngine::Parameter>& options) const override;
 
     std::map<std::string, std::string> config;
 };
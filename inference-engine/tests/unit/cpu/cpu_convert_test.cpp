@@ -0,0 +1,113 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/cpu_convert.h"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using MKLDNNPlugin::bfloat16_t;
+
+namespace {
+
+float readValue(const std::vector<uint8_t>& data, Precision prc, size_t i) {
+    switch (prc) {
+        case Precision::U8:   return reinterpret_cast<const uint8_t*>(data.data())[i];
+        case Precision::I8:   return reinterpret_cast<const int8_t*>(data.data())[i];
+        case Precision::U16:  return reinterpret_cast<const uint16_t*>(data.data())[i];
+        case Precision::I16:  return reinterpret_cast<const int16_t*>(data.data())[i];
+        case Precision::I32:  return static_cast<float>(reinterpret_cast<const int32_t*>(data.data())[i]);
+        case Precision::FP32: return reinterpret_cast<const float*>(data.data())[i];
+        case Precision::BF16: return reinterpret_cast<const bfloat16_t*>(data.data())[i];
+        default: THROW_IE_EXCEPTION << "Unsupported precision " << prc;
+    }
+}
+
+void writeValue(std::vector<uint8_t>& data, Precision prc, size_t i, float value) {
+    switch (prc) {
+        case Precision::U8:   reinterpret_cast<uint8_t*>(data.data())[i] = static_cast<uint8_t>(value); break;
+        case Precision::I8:   reinterpret_cast<int8_t*>(data.data())[i] = static_cast<int8_t>(value); break;
+        case Precision::U16:  reinterpret_cast<uint16_t*>(data.data())[i] = static_cast<uint16_t>(value); break;
+        case Precision::I16:  reinterpret_cast<int16_t*>(data.data())[i] = static_cast<int16_t>(value); break;
+        case Precision::I32:  reinterpret_cast<int32_t*>(data.data())[i] = static_cast<int32_t>(value); break;
+        case Precision::FP32: reinterpret_cast<float*>(data.data())[i] = value; break;
+        case Precision::BF16: reinterpret_cast<bfloat16_t*>(data.data())[i] = bfloat16_t(value); break;
+        default: THROW_IE_EXCEPTION << "Unsupported precision " << prc;
+    }
+}
+
+// values are in the range of all the precisions, so the element-wise conversion below is the reference
+std::vector<uint8_t> makeData(Precision prc, size_t size) {
+    std::vector<uint8_t> data(size * prc.size());
+    for (size_t i = 0; i < size; i++) {
+        writeValue(data, prc, i, static_cast<float>((i * 37) % 101) + 0.375f);
+    }
+    return data;
+}
+
+std::vector<uint8_t> makeReference(const std::vector<uint8_t>& src, Precision srcPrc, Precision dstPrc, size_t size) {
+    std::vector<uint8_t> dst(size * dstPrc.size());
+    for (size_t i = 0; i < size; i++) {
+        writeValue(dst, dstPrc, i, readValue(src, srcPrc, i));
+    }
+    return dst;
+}
+
+const std::vector<Precision> precisions = {
+    Precision::U8, Precision::I8, Precision::U16, Precision::I16, Precision::I32, Precision::FP32, Precision::BF16
+};
+
+}  // namespace
+
+using CpuConvertTest = ::testing::TestWithParam<std::tuple<Precision, Precision>>;
+
+TEST_P(CpuConvertTest, MatchesElementWiseConversion) {
+    Precision srcPrc, dstPrc;
+    std::tie(srcPrc, dstPrc) = GetParam();
+
+    // sizes below and above the block converted by one thread, with tails after the vectorized part
+    for (size_t size : {1, 15, 16 * 1024 + 7, 5 * 16 * 1024 + 3}) {
+        const auto src = makeData(srcPrc, size);
+        const auto ref = makeReference(src, srcPrc, dstPrc, size);
+        std::vector<uint8_t> dst(size * dstPrc.size());
+        cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+        ASSERT_EQ(0, std::memcmp(ref.data(), dst.data(), dst.size())) << "size: " << size;
+    }
+}
+
+// reports the bandwidth of the conversion, counting both the read and the written bytes;
+// it checks nothing, so it runs only on request with --gtest_also_run_disabled_tests
+TEST_P(CpuConvertTest, DISABLED_Bandwidth) {
+    Precision srcPrc, dstPrc;
+    std::tie(srcPrc, dstPrc) = GetParam();
+
+    constexpr size_t size = 4 * 1024 * 1024;
+    constexpr int iterations = 10;
+    const auto src = makeData(srcPrc, size);
+    std::vector<uint8_t> dst(size * dstPrc.size());
+    cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        cpu_convert(src.data(), dst.data(), srcPrc, dstPrc, size);
+    }
+    auto finish = std::chrono::high_resolution_clock::now();
+    const double seconds = std::chrono::duration<double>(finish - start).count() / iterations;
+    std::cout << srcPrc << " -> " << dstPrc << ": "
+              << static_cast<double>(src.size() + dst.size()) / seconds / 1e9 << " GB/s" << std::endl;
+}
+
+INSTANTIATE_TEST_CASE_P(CpuConvert, CpuConvertTest,
+                        ::testing::Combine(::testing::ValuesIn(precisions),
+                                           ::testing::ValuesIn(precisions)),
+                        [](const ::testing::TestParamInfo<std::tuple<Precision, Precision>>& obj) {
+                            return std::string(std::get<0>(obj.param).name()) + "_" + std::get<1>(obj.param).name();
+                        });
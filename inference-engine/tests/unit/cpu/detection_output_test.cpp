@@ -0,0 +1,227 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ext_layer_test_utils.hpp"
+
+using namespace InferenceEngine;
+using CPUUnitTestUtils::ExtLayer;
+
+namespace {
+
+struct SSDDetectionOutputParams {
+    int numClasses;
+    int backgroundLabelId;
+    int topK;
+    int keepTopK;
+    float nmsThreshold;
+    float confidenceThreshold;
+    bool shareLocation;
+    bool decreaseLabelId;
+};
+
+float refJaccardOverlap(const float* boxes, const float* sizes, int idx1, int idx2) {
+    const float xmin1 = boxes[idx1 * 4 + 0], ymin1 = boxes[idx1 * 4 + 1];
+    const float xmax1 = boxes[idx1 * 4 + 2], ymax1 = boxes[idx1 * 4 + 3];
+    const float xmin2 = boxes[idx2 * 4 + 0], ymin2 = boxes[idx2 * 4 + 1];
+    const float xmax2 = boxes[idx2 * 4 + 2], ymax2 = boxes[idx2 * 4 + 3];
+    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
+        return 0.0f;
+    }
+    const float width = (std::min)(xmax1, xmax2) - (std::max)(xmin1, xmin2);
+    const float height = (std::min)(ymax1, ymax2) - (std::max)(ymin1, ymin2);
+    if (width <= 0 || height <= 0) {
+        return 0.0f;
+    }
+    const float intersection = width * height;
+    return intersection / (sizes[idx1] + sizes[idx2] - intersection);
+}
+
+// DetectionOutput as it was implemented before NMS was vectorized: a candidate is compared with kept boxes
+// one by one and candidates are ordered by partial_sort_copy. Boxes are decoded as CORNER boxes with variance
+// encoded in target, so they are priors moved by locations.
+std::vector<float> refSSDDetectionOutput(const SSDDetectionOutputParams& p, const float* loc, const float* conf,
+                                         const float* priors, int N, int P, int numResults) {
+    const int C = p.numClasses;
+    const int L = p.shareLocation ? 1 : C;
+    std::vector<float> boxes(N * L * P * 4), sizes(N * L * P);
+    for (int i = 0; i < N * L * P; i++) {
+        const int prior = i % P;
+        for (int j = 0; j < 4; j++) {
+            // locations of a prior are stored for all location classes together
+            boxes[i * 4 + j] = priors[prior * 4 + j] + loc[((i / (L * P)) * P + prior) * L * 4 + (i / P % L) * 4 + j];
+        }
+        sizes[i] = (boxes[i * 4 + 2] - boxes[i * 4 + 0]) * (boxes[i * 4 + 3] - boxes[i * 4 + 1]);
+    }
+
+    std::vector<float> output(numResults * 7, 0.0f);
+    int count = 0;
+    for (int n = 0; n < N; n++) {
+        std::vector<float> reordered(C * P);
+        for (int c = 0; c < C; c++) {
+            for (int i = 0; i < P; i++) {
+                reordered[c * P + i] = conf[(n * P + i) * C + c];
+            }
+        }
+        auto byConfidence = [&](int idx1, int idx2) {
+            return reordered[idx1] > reordered[idx2] || (reordered[idx1] == reordered[idx2] && idx1 < idx2);
+        };
+        auto sortTopK = [&](const std::vector<int>& candidates) {
+            std::vector<int> sorted(p.topK == -1 ? candidates.size() : (std::min)(candidates.size(), size_t(p.topK)));
+            std::partial_sort_copy(candidates.begin(), candidates.end(), sorted.begin(), sorted.end(), byConfidence);
+            return sorted;
+        };
+        auto boxesOf = [&](int c) { return boxes.data() + (n * L + (p.shareLocation ? 0 : c)) * P * 4; };
+        auto sizesOf = [&](int c) { return sizes.data() + (n * L + (p.shareLocation ? 0 : c)) * P; };
+        auto suppressed = [&](int c, const std::vector<int>& kept, int prior) {
+            for (int k : kept) {
+                if (refJaccardOverlap(boxesOf(c), sizesOf(c), prior, k) > p.nmsThreshold) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        std::vector<std::vector<int>> kept(C);
+        if (!p.decreaseLabelId) {
+            for (int c = 0; c < C; c++) {
+                if (c == p.backgroundLabelId) {
+                    continue;
+                }
+                std::vector<int> candidates;
+                for (int i = 0; i < P; i++) {
+                    if (reordered[c * P + i] > p.confidenceThreshold) {
+                        candidates.push_back(c * P + i);
+                    }
+                }
+                for (int idx : sortTopK(candidates)) {
+                    if (!suppressed(c, kept[c], idx % P)) {
+                        kept[c].push_back(idx % P);
+                    }
+                }
+            }
+        } else {
+            std::vector<int> candidates;
+            for (int i = 0; i < P; i++) {
+                float best = -1;
+                int id = 0;
+                for (int c = 1; c < C; c++) {
+                    if (reordered[c * P + i] > best) {
+                        best = reordered[c * P + i];
+                        id = c;
+                    }
+                }
+                if (id > 0 && best >= p.confidenceThreshold) {
+                    candidates.push_back(id * P + i);
+                }
+            }
+            for (int idx : sortTopK(candidates)) {
+                const int c = idx / P;
+                if (!suppressed(c, kept[c], idx % P)) {
+                    kept[c].push_back(idx % P);
+                }
+            }
+        }
+
+        size_t total = 0;
+        for (const auto& classKept : kept) {
+            total += classKept.size();
+        }
+        if (p.keepTopK > -1 && total > static_cast<size_t>(p.keepTopK)) {
+            std::vector<std::pair<float, std::pair<int, int>>> detections;
+            for (int c = 0; c < C; c++) {
+                for (int prior : kept[c]) {
+                    detections.push_back({reordered[c * P + prior], {c, prior}});
+                }
+            }
+            std::sort(detections.begin(), detections.end(), [](const std::pair<float, std::pair<int, int>>& a,
+                                                               const std::pair<float, std::pair<int, int>>& b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second);
+            });
+            detections.resize(p.keepTopK);
+            kept.assign(C, {});
+            for (const auto& detection : detections) {
+                kept[detection.second.first].push_back(detection.second.second);
+            }
+        }
+
+        for (int c = 0; c < C; c++) {
+            for (int prior : kept[c]) {
+                float* dst = output.data() + count * 7;
+                dst[0] = static_cast<float>(n);
+                dst[1] = static_cast<float>(p.decreaseLabelId ? c - 1 : c);
+                dst[2] = reordered[c * P + prior];
+                std::copy_n(boxesOf(c) + prior * 4, 4, dst + 3);
+                count++;
+            }
+        }
+    }
+    if (count < numResults) {
+        output[count * 7] = -1;
+    }
+    return output;
+}
+
+}  // namespace
+
+class SSDDetectionOutputTest : public ::testing::TestWithParam<SSDDetectionOutputParams> {};
+
+// Boxes lie on a coarse grid and confidences take a few values, so there are many equal confidences,
+// equal boxes and overlaps equal to the threshold
+TEST_P(SSDDetectionOutputTest, MatchesNonVectorizedNMSWithTies) {
+    const auto& p = GetParam();
+    const int N = 2, P = 300;
+    const int L = p.shareLocation ? 1 : p.numClasses;
+    const int numResults = p.keepTopK > 0 ? N * p.keepTopK : N * p.numClasses * P;
+    ExtLayer layer("DetectionOutput",
+                   {{"num_classes", std::to_string(p.numClasses)},
+                    {"background_label_id", std::to_string(p.backgroundLabelId)},
+                    {"top_k", std::to_string(p.topK)}, {"keep_top_k", std::to_string(p.keepTopK)},
+                    {"nms_threshold", std::to_string(p.nmsThreshold)},
+                    {"confidence_threshold", std::to_string(p.confidenceThreshold)},
+                    {"share_location", p.shareLocation ? "1" : "0"},
+                    {"decrease_label_id", p.decreaseLabelId ? "1" : "0"},
+                    {"variance_encoded_in_target", "1"}, {"code_type", "caffe.PriorBoxParameter.CORNER"}},
+                   {{N, static_cast<size_t>(P * L * 4)}, {N, static_cast<size_t>(P * p.numClasses)}, {1, 2, P * 4}},
+                   {{1, 1, static_cast<size_t>(numResults), 7}});
+
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> cell(0, 7), extent(1, 4), shift(-1, 1), level(0, 4);
+    for (int i = 0; i < P; i++) {
+        float* prior = layer.input(2) + i * 4;
+        prior[0] = cell(generator) * 0.125f;
+        prior[1] = cell(generator) * 0.125f;
+        prior[2] = prior[0] + extent(generator) * 0.125f;
+        prior[3] = prior[1] + extent(generator) * 0.125f;
+    }
+    std::fill_n(layer.input(2) + P * 4, P * 4, 0.1f);
+    for (int i = 0; i < N * P * L * 4; i++) {
+        layer.input(0)[i] = shift(generator) * 0.0625f;
+    }
+    for (int i = 0; i < N * P * p.numClasses; i++) {
+        layer.input(1)[i] = level(generator) * 0.25f;
+    }
+
+    ASSERT_EQ(OK, layer.execute());
+    const auto expected = refSSDDetectionOutput(p, layer.input(0), layer.input(1), layer.input(2), N, P, numResults);
+    for (int i = 0; i < numResults * 7; i++) {
+        ASSERT_EQ(expected[i], layer.output(0)[i]) << "detection: " << i / 7 << " field: " << i % 7;
+        if (i % 7 == 0 && expected[i] == -1) {
+            break;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(DetectionOutput, SSDDetectionOutputTest, ::testing::Values(
+        SSDDetectionOutputParams{5, 0, -1, -1, 0.5f, 0.3f, true, false},
+        SSDDetectionOutputParams{5, 0, 100, 60, 0.5f, 0.3f, true, false},
+        SSDDetectionOutputParams{5, 2, 50, 40, 0.25f, 0.0f, false, false},
+        SSDDetectionOutputParams{5, 0, -1, -1, 0.5f, 0.5f, true, true},
+        SSDDetectionOutputParams{5, 0, 120, 30, 0.5f, 0.25f, false, true}));
@@ -0,0 +1,245 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ext_layer_test_utils.hpp"
+
+using namespace InferenceEngine;
+using CPUUnitTestUtils::ExtLayer;
+
+namespace {
+
+void fillRandom(float* data, size_t size, float low, float high, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::generate_n(data, size, [&] { return distribution(generator); });
+}
+
+// boxes with corners in [0, imageSize] and sizes up to maxBoxSize
+void fillBoxes(float* boxes, size_t num, float imageSize, float maxBoxSize, std::mt19937& generator) {
+    std::uniform_real_distribution<float> corner(0.0f, imageSize);
+    std::uniform_real_distribution<float> size(1.0f, maxBoxSize);
+    for (size_t i = 0; i < num; i++) {
+        boxes[4 * i + 0] = corner(generator);
+        boxes[4 * i + 1] = corner(generator);
+        boxes[4 * i + 2] = (std::min)(boxes[4 * i + 0] + size(generator), imageSize);
+        boxes[4 * i + 3] = (std::min)(boxes[4 * i + 1] + size(generator), imageSize);
+    }
+}
+
+// ROIAlign of Caffe2 computed for every sampling point separately
+void refROIAlign(const float* featureMap, int channels, int height, int width, const float* roi, float scale,
+                 int pooled, int samplingRatio, bool aligned, float* dst) {
+    const float offset = aligned ? 0.5f : 0.0f;
+    const float startW = roi[0] * scale - offset;
+    const float startH = roi[1] * scale - offset;
+    const float roiW = (std::max)(roi[2] * scale - offset - startW, 1.0f);
+    const float roiH = (std::max)(roi[3] * scale - offset - startH, 1.0f);
+    const float binW = roiW / pooled;
+    const float binH = roiH / pooled;
+    const int gridH = samplingRatio > 0 ? samplingRatio : static_cast<int>(std::ceil(roiH / pooled));
+    const int gridW = samplingRatio > 0 ? samplingRatio : static_cast<int>(std::ceil(roiW / pooled));
+
+    for (int c = 0; c < channels; c++) {
+        const float* data = featureMap + c * height * width;
+        for (int ph = 0; ph < pooled; ph++) {
+            for (int pw = 0; pw < pooled; pw++) {
+                float sum = 0.0f;
+                for (int iy = 0; iy < gridH; iy++) {
+                    for (int ix = 0; ix < gridW; ix++) {
+                        float y = startH + ph * binH + (iy + .5f) * binH / gridH;
+                        float x = startW + pw * binW + (ix + .5f) * binW / gridW;
+                        if (y < -1.0f || y > height || x < -1.0f || x > width)
+                            continue;
+                        y = (std::max)(y, 0.0f);
+                        x = (std::max)(x, 0.0f);
+                        int y0 = static_cast<int>(y), x0 = static_cast<int>(x);
+                        int y1 = y0 + 1, x1 = x0 + 1;
+                        if (y0 >= height - 1) {
+                            y1 = y0 = height - 1;
+                            y = static_cast<float>(y0);
+                        }
+                        if (x0 >= width - 1) {
+                            x1 = x0 = width - 1;
+                            x = static_cast<float>(x0);
+                        }
+                        const float ly = y - y0, lx = x - x0;
+                        sum += (1 - ly) * (1 - lx) * data[y0 * width + x0] + (1 - ly) * lx * data[y0 * width + x1] +
+                               ly * (1 - lx) * data[y1 * width + x0] + ly * lx * data[y1 * width + x1];
+                    }
+                }
+                dst[(c * pooled + ph) * pooled + pw] = sum / (gridH * gridW);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+class ROIFeatureExtractorTest : public ::testing::TestWithParam<std::tuple<int, bool>> {};
+
+TEST_P(ROIFeatureExtractorTest, MatchesReference) {
+    int samplingRatio;
+    bool aligned;
+    std::tie(samplingRatio, aligned) = GetParam();
+
+    const size_t roisNum = 64, channels = 5, height = 19, width = 27, pooled = 7;
+    const float scale = 4.0f;
+    ExtLayer layer("ExperimentalDetectronROIFeatureExtractor",
+                   {{"output_size", std::to_string(pooled)}, {"pyramid_scales", "4"},
+                    {"sampling_ratio", std::to_string(samplingRatio)}, {"aligned", aligned ? "true" : "false"}},
+                   {{roisNum, 4}, {1, channels, height, width}},
+                   {{roisNum, channels, pooled, pooled}, {roisNum, 4}});
+
+    std::mt19937 generator(7);
+    // ROIs partially out of the image, malformed and empty ones are included
+    fillBoxes(layer.input(0), roisNum, width * scale * 1.2f, width * scale, generator);
+    std::copy_n(std::vector<float>{10.f, 10.f, 10.5f, 10.5f}.data(), 4, layer.input(0) + 4);
+    std::copy_n(std::vector<float>{30.f, 20.f, 30.f, 40.f}.data(), 4, layer.input(0) + 8);
+    fillRandom(layer.input(1), channels * height * width, -10.0f, 10.0f, generator);
+    ASSERT_EQ(OK, layer.execute());
+
+    const size_t roiSize = channels * pooled * pooled;
+    std::vector<float> expected(roiSize);
+    for (size_t roi = 0; roi < roisNum; roi++) {
+        const float* box = layer.input(0) + 4 * roi;
+        if ((box[2] - box[0]) * (box[3] - box[1]) > 0) {
+            refROIAlign(layer.input(1), channels, height, width, box, 1.0f / scale, pooled, samplingRatio, aligned,
+                        expected.data());
+        } else {
+            std::fill(expected.begin(), expected.end(), 0.0f);
+        }
+        for (size_t i = 0; i < roiSize; i++) {
+            ASSERT_NEAR(expected[i], layer.output(0)[roi * roiSize + i], 1e-4f) << "roi: " << roi << " i: " << i;
+        }
+        for (size_t i = 0; i < 4; i++) {
+            ASSERT_EQ(box[i], layer.output(1)[4 * roi + i]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(DetectronOps, ROIFeatureExtractorTest,
+                        ::testing::Combine(::testing::Values(0, 2), ::testing::Bool()));
+
+TEST(DetectionOutputTest, OverlappedBoxesAreSuppressedPerClass) {
+    const size_t roisNum = 3, classesNum = 3, maxDetections = 5;
+    ExtLayer layer("ExperimentalDetectronDetectionOutput",
+                   {{"score_threshold", "0.05"}, {"nms_threshold", "0.5"}, {"max_delta_log_wh", "4.135"},
+                    {"num_classes", std::to_string(classesNum)}, {"post_nms_count", "10"},
+                    {"max_detections_per_image", std::to_string(maxDetections)},
+                    {"deltas_weights", "10,10,5,5"}},
+                   {{roisNum, 4}, {roisNum, classesNum * 4}, {roisNum, classesNum}, {1, 3}},
+                   {{maxDetections, 4}, {maxDetections}, {maxDetections}},
+                   {}, {Precision::FP32, Precision::I32, Precision::FP32});
+
+    const std::vector<float> rois = {0, 0, 9, 9,  1, 1, 10, 10,  20, 20, 29, 29};
+    // the second box overlaps the first one, it is suppressed in class 1 where its score is lower
+    const std::vector<float> scores = {0.0f, 0.9f, 0.3f,
+                                       0.0f, 0.8f, 0.6f,
+                                       0.0f, 0.01f, 0.7f};
+    std::copy(rois.begin(), rois.end(), layer.input(0));
+    std::fill_n(layer.input(1), roisNum * classesNum * 4, 0.0f);
+    std::copy(scores.begin(), scores.end(), layer.input(2));
+    std::copy_n(std::vector<float>{100, 100, 1}.data(), 3, layer.input(3));
+    ASSERT_EQ(OK, layer.execute());
+
+    // detections are ordered by class since their number doesn't exceed max_detections_per_image
+    const std::vector<int> expectedClasses = {1, 2, 2, 0, 0};
+    const std::vector<float> expectedScores = {0.9f, 0.7f, 0.6f, 0.0f, 0.0f};
+    const std::vector<float> expectedBoxes = {0, 0, 9, 9,  20, 20, 29, 29,  1, 1, 10, 10,  0, 0, 0, 0,  0, 0, 0, 0};
+    for (size_t i = 0; i < maxDetections; i++) {
+        ASSERT_EQ(expectedClasses[i], layer.output<int32_t>(1)[i]) << i;
+        ASSERT_FLOAT_EQ(expectedScores[i], layer.output(2)[i]) << i;
+        for (size_t j = 0; j < 4; j++) {
+            ASSERT_NEAR(expectedBoxes[4 * i + j], layer.output(0)[4 * i + j], 1e-4f) << i;
+        }
+    }
+}
+
+TEST(TopKROIsTest, RoisOfEqualProbabilityAreTakenInInputOrder) {
+    const size_t roisNum = 6, topNum = 4;
+    ExtLayer layer("ExperimentalDetectronTopKROIs", {{"max_rois", std::to_string(topNum)}},
+                   {{roisNum, 4}, {roisNum}}, {{topNum, 4}});
+    for (size_t i = 0; i < 4 * roisNum; i++) {
+        layer.input(0)[i] = static_cast<float>(i / 4);
+    }
+    std::copy_n(std::vector<float>{0.1f, 0.5f, 0.9f, 0.5f, 0.2f, 0.5f}.data(), roisNum, layer.input(1));
+    ASSERT_EQ(OK, layer.execute());
+
+    const std::vector<float> expected = {2, 1, 3, 5};
+    for (size_t i = 0; i < topNum; i++) {
+        ASSERT_EQ(expected[i], layer.output(0)[4 * i]) << i;
+    }
+}
+
+// Timings of the Mask R-CNN post-processing of an 800x1344 image with 1000 ROIs;
+// it checks nothing, so it runs only on request with --gtest_also_run_disabled_tests
+TEST(DetectronOpsPerformance, DISABLED_Benchmark) {
+    std::mt19937 generator(1);
+    const size_t roisNum = 1000, channels = 256, pooled = 7, classesNum = 81;
+    const float imageH = 800, imageW = 1344;
+
+    {
+        const size_t anchorsNum = 3, height = 200, width = 336, proposalsNum = anchorsNum * height * width;
+        ExtLayer layer("ExperimentalDetectronGenerateProposalsSingleImage",
+                       {{"min_size", "0"}, {"nms_threshold", "0.7"},
+                        {"pre_nms_count", "1000"}, {"post_nms_count", std::to_string(roisNum)}},
+                       {{3}, {proposalsNum, 4}, {anchorsNum * 4, height, width}, {anchorsNum, height, width}},
+                       {{roisNum, 4}, {roisNum}});
+        std::copy_n(std::vector<float>{imageH, imageW, 1.0f}.data(), 3, layer.input(0));
+        fillBoxes(layer.input(1), proposalsNum, imageW, 256.0f, generator);
+        fillRandom(layer.input(2), proposalsNum * 4, -0.5f, 0.5f, generator);
+        fillRandom(layer.input(3), proposalsNum, 0.0f, 1.0f, generator);
+        std::cout << "GenerateProposalsSingleImage: " << layer.benchmark() << " ms" << std::endl;
+    }
+
+    {
+        const size_t inputRoisNum = 4000;
+        ExtLayer layer("ExperimentalDetectronTopKROIs", {{"max_rois", std::to_string(roisNum)}},
+                       {{inputRoisNum, 4}, {inputRoisNum}}, {{roisNum, 4}});
+        fillBoxes(layer.input(0), inputRoisNum, imageW, 256.0f, generator);
+        fillRandom(layer.input(1), inputRoisNum, 0.0f, 1.0f, generator);
+        std::cout << "TopKROIs: " << layer.benchmark() << " ms" << std::endl;
+    }
+
+    {
+        const std::vector<size_t> strides = {4, 8, 16, 32};
+        std::vector<SizeVector> inputDims = {{roisNum, 4}};
+        for (auto stride : strides) {
+            inputDims.push_back({1, channels, static_cast<size_t>(imageH) / stride, static_cast<size_t>(imageW) / stride});
+        }
+        ExtLayer layer("ExperimentalDetectronROIFeatureExtractor",
+                       {{"output_size", std::to_string(pooled)}, {"pyramid_scales", "4,8,16,32"},
+                        {"sampling_ratio", "2"}, {"aligned", "false"}},
+                       inputDims, {{roisNum, channels, pooled, pooled}, {roisNum, 4}});
+        fillBoxes(layer.input(0), roisNum, imageW, 512.0f, generator);
+        for (size_t i = 1; i < inputDims.size(); i++) {
+            fillRandom(layer.input(i), channels * inputDims[i][2] * inputDims[i][3], -1.0f, 1.0f, generator);
+        }
+        std::cout << "ROIFeatureExtractor: " << layer.benchmark() << " ms" << std::endl;
+    }
+
+    {
+        const size_t maxDetections = 100;
+        ExtLayer layer("ExperimentalDetectronDetectionOutput",
+                       {{"score_threshold", "0.05"}, {"nms_threshold", "0.5"}, {"max_delta_log_wh", "4.135"},
+                        {"num_classes", std::to_string(classesNum)}, {"post_nms_count", "2000"},
+                        {"max_detections_per_image", std::to_string(maxDetections)},
+                        {"deltas_weights", "10,10,5,5"}},
+                       {{roisNum, 4}, {roisNum, classesNum * 4}, {roisNum, classesNum}, {1, 3}},
+                       {{maxDetections, 4}, {maxDetections}, {maxDetections}},
+                       {}, {Precision::FP32, Precision::I32, Precision::FP32});
+        fillBoxes(layer.input(0), roisNum, imageW, 256.0f, generator);
+        fillRandom(layer.input(1), roisNum * classesNum * 4, -0.5f, 0.5f, generator);
+        fillRandom(layer.input(2), roisNum * classesNum, 0.0f, 0.2f, generator);
+        std::copy_n(std::vector<float>{imageH, imageW, 1.0f}.data(), 3, layer.input(3));
+        std::cout << "DetectionOutput: " << layer.benchmark() << " ms" << std::endl;
+    }
+}
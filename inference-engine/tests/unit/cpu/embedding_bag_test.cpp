@@ -0,0 +1,188 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ext_layer_test_utils.hpp"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using CPUUnitTestUtils::ExtLayer;
+using MKLDNNPlugin::bfloat16_t;
+
+namespace {
+
+struct Bags {
+    std::vector<int32_t> indices;
+    std::vector<int32_t> offsets;
+    std::vector<float> weights;
+};
+
+// bags of random rows, the number of rows of a bag is in [0, 2 * poolingFactor]
+Bags makeBags(size_t bagsNum, size_t poolingFactor, size_t rowsNum, std::mt19937& generator) {
+    std::uniform_int_distribution<size_t> bagSize(0, 2 * poolingFactor);
+    std::uniform_int_distribution<int32_t> row(0, static_cast<int32_t>(rowsNum) - 1);
+    std::uniform_real_distribution<float> weight(-1.0f, 1.0f);
+    Bags bags;
+    for (size_t bag = 0; bag < bagsNum; bag++) {
+        bags.offsets.push_back(static_cast<int32_t>(bags.indices.size()));
+        for (size_t i = bagSize(generator); i > 0; i--) {
+            bags.indices.push_back(row(generator));
+            bags.weights.push_back(weight(generator));
+        }
+    }
+    return bags;
+}
+
+std::vector<float> refBagsSum(const std::vector<float>& table, size_t depth, const Bags& bags, bool withWeights) {
+    std::vector<float> dst(bags.offsets.size() * depth, 0.0f);
+    for (size_t bag = 0; bag < bags.offsets.size(); bag++) {
+        const size_t end = bag + 1 < bags.offsets.size() ? bags.offsets[bag + 1] : bags.indices.size();
+        for (size_t i = bags.offsets[bag]; i < end; i++) {
+            for (size_t j = 0; j < depth; j++) {
+                dst[bag * depth + j] += table[bags.indices[i] * depth + j] * (withWeights ? bags.weights[i] : 1.0f);
+            }
+        }
+    }
+    return dst;
+}
+
+ExtLayer makeOffsetsSum(size_t rowsNum, size_t depth, const Bags& bags, Precision tablePrecision, bool withWeights) {
+    std::vector<SizeVector> inputDims = {{rowsNum, depth}, {bags.indices.size()}, {bags.offsets.size()}};
+    std::vector<Precision> inputPrecisions = {tablePrecision, Precision::I32, Precision::I32};
+    if (withWeights) {
+        inputDims.push_back({});
+        inputDims.push_back({bags.indices.size()});
+        inputPrecisions.push_back(Precision::I32);
+        inputPrecisions.push_back(Precision::FP32);
+    }
+    ExtLayer layer("EmbeddingBagOffsetsSum", {}, inputDims, {{bags.offsets.size(), depth}}, inputPrecisions);
+    std::copy(bags.indices.begin(), bags.indices.end(), layer.input<int32_t>(1));
+    std::copy(bags.offsets.begin(), bags.offsets.end(), layer.input<int32_t>(2));
+    if (withWeights) {
+        layer.input<int32_t>(3)[0] = 0;
+        std::copy(bags.weights.begin(), bags.weights.end(), layer.input(4));
+    }
+    return layer;
+}
+
+}  // namespace
+
+class EmbeddingBagOffsetsSumTest : public ::testing::TestWithParam<std::tuple<Precision, bool>> {};
+
+TEST_P(EmbeddingBagOffsetsSumTest, MatchesReference) {
+    Precision tablePrecision;
+    bool withWeights;
+    std::tie(tablePrecision, withWeights) = GetParam();
+
+    // the depth is not a multiple of the vector length
+    const size_t rowsNum = 1000, depth = 37;
+    std::mt19937 generator(3);
+    const Bags bags = makeBags(64, 10, rowsNum, generator);
+    std::vector<float> table(rowsNum * depth);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    for (auto& v : table) {
+        v = value(generator);
+        // the reference is computed from the values stored in the table
+        if (tablePrecision == Precision::BF16)
+            v = bfloat16_t(v);
+    }
+
+    auto layer = makeOffsetsSum(rowsNum, depth, bags, tablePrecision, withWeights);
+    if (tablePrecision == Precision::BF16) {
+        std::transform(table.begin(), table.end(), layer.input<bfloat16_t>(0), [](float v) { return bfloat16_t(v); });
+    } else {
+        std::copy(table.begin(), table.end(), layer.input(0));
+    }
+    ASSERT_EQ(OK, layer.execute());
+
+    // empty bags are filled by the row of the default index if it is given
+    if (withWeights) {
+        for (size_t bag = 0; bag < bags.offsets.size(); bag++) {
+            const size_t end = bag + 1 < bags.offsets.size() ? bags.offsets[bag + 1] : bags.indices.size();
+            if (bags.offsets[bag] == end) {
+                for (size_t j = 0; j < depth; j++) {
+                    ASSERT_EQ(table[j], layer.output(0)[bag * depth + j]);
+                }
+            }
+        }
+    }
+    const auto expected = refBagsSum(table, depth, bags, withWeights);
+    for (size_t bag = 0; bag < bags.offsets.size(); bag++) {
+        const size_t end = bag + 1 < bags.offsets.size() ? bags.offsets[bag + 1] : bags.indices.size();
+        if (withWeights && bags.offsets[bag] == end)
+            continue;
+        for (size_t j = 0; j < depth; j++) {
+            ASSERT_NEAR(expected[bag * depth + j], layer.output(0)[bag * depth + j], 1e-4f) << "bag: " << bag;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(EmbeddingBag, EmbeddingBagOffsetsSumTest,
+                        ::testing::Combine(::testing::Values(Precision::FP32, Precision::BF16), ::testing::Bool()),
+                        [](const ::testing::TestParamInfo<std::tuple<Precision, bool>>& obj) {
+                            return std::string(std::get<0>(obj.param).name()) +
+                                   (std::get<1>(obj.param) ? "_Weighted" : "");
+                        });
+
+TEST(EmbeddingBagTest, InvalidIndexIsReported) {
+    std::mt19937 generator(5);
+    Bags bags = makeBags(8, 4, 10, generator);
+    bags.indices.push_back(10);
+    auto layer = makeOffsetsSum(10, 4, bags, Precision::FP32, false);
+    ResponseDesc resp;
+    ASSERT_EQ(GENERAL_ERROR, layer.execute(&resp));
+    ASSERT_NE(std::string::npos, std::string(resp.msg).find("invalid embedding bag index: 10"));
+}
+
+TEST(EmbeddingBagTest, SegmentsAreSummed) {
+    const size_t rowsNum = 5, depth = 3, segmentsNum = 4;
+    const std::vector<int32_t> indices = {0, 2, 4, 1, 3, 3};
+    // segment 1 is empty and takes the default row, the last id is out of the segments and is ignored
+    const std::vector<int32_t> segmentIds = {0, 0, 2, 3, 3, 7};
+    ExtLayer layer("EmbeddingSegmentsSum", {},
+                   {{rowsNum, depth}, {indices.size()}, {segmentIds.size()}, {}, {}},
+                   {{segmentsNum, depth}},
+                   {Precision::FP32, Precision::I32, Precision::I32, Precision::I32, Precision::I32});
+    for (size_t i = 0; i < rowsNum * depth; i++) {
+        layer.input(0)[i] = static_cast<float>(i);
+    }
+    std::copy(indices.begin(), indices.end(), layer.input<int32_t>(1));
+    std::copy(segmentIds.begin(), segmentIds.end(), layer.input<int32_t>(2));
+    layer.input<int32_t>(3)[0] = segmentsNum;
+    layer.input<int32_t>(4)[0] = 1;
+    ASSERT_EQ(OK, layer.execute());
+
+    const std::vector<float> expected = {6, 8, 10,  3, 4, 5,  12, 13, 14,  12, 14, 16};
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], layer.output(0)[i]) << i;
+    }
+}
+
+// Lookups of a DLRM-like model: 2048 samples of 80 rows on average from a table of 64-element rows;
+// it checks nothing, so it runs only on request with --gtest_also_run_disabled_tests
+TEST(EmbeddingBagPerformance, DISABLED_Benchmark) {
+    const size_t rowsNum = 500000, depth = 64, bagsNum = 2048, poolingFactor = 80;
+    std::mt19937 generator(1);
+    const Bags bags = makeBags(bagsNum, poolingFactor, rowsNum, generator);
+
+    for (auto tablePrecision : {Precision::FP32, Precision::BF16}) {
+        auto layer = makeOffsetsSum(rowsNum, depth, bags, tablePrecision, true);
+        std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+        if (tablePrecision == Precision::BF16) {
+            std::generate_n(layer.input<bfloat16_t>(0), rowsNum * depth, [&] { return bfloat16_t(value(generator)); });
+        } else {
+            std::generate_n(layer.input(0), rowsNum * depth, [&] { return value(generator); });
+        }
+        ASSERT_EQ(OK, layer.execute());
+        const double ms = layer.benchmark();
+        std::cout << tablePrecision << " table: " << ms << " ms, "
+                  << static_cast<double>(bags.indices.size()) / ms / 1e3 << " M rows/s" << std::endl;
+    }
+}
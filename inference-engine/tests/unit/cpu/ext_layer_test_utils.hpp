@@ -0,0 +1,92 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include "nodes/list.hpp"
+
+namespace CPUUnitTestUtils {
+
+// Layer executed by the implementation registered in the CPU extensions
+class ExtLayer {
+public:
+    ExtLayer(const std::string& type, const std::map<std::string, std::string>& params,
+             const std::vector<InferenceEngine::SizeVector>& inputDims,
+             const std::vector<InferenceEngine::SizeVector>& outputDims,
+             const std::vector<InferenceEngine::Precision>& inputPrecisions = {},
+             const std::vector<InferenceEngine::Precision>& outputPrecisions = {}) {
+        using namespace InferenceEngine;
+        auto precisionOf = [](const std::vector<Precision>& precisions, size_t i) {
+            return i < precisions.size() ? precisions[i] : Precision(Precision::FP32);
+        };
+
+        layer = std::make_shared<CNNLayer>(LayerParams{type, type, Precision::FP32});
+        layer->params = params;
+        for (size_t i = 0; i < inputDims.size(); i++) {
+            TensorDesc desc(precisionOf(inputPrecisions, i), inputDims[i], TensorDesc::getLayoutByDims(inputDims[i]));
+            inputData.push_back(std::make_shared<Data>("in" + std::to_string(i), desc));
+            layer->insData.push_back(inputData.back());
+            inputs.push_back(make_blob_with_precision(desc));
+            inputs.back()->allocate();
+        }
+        for (size_t i = 0; i < outputDims.size(); i++) {
+            TensorDesc desc(precisionOf(outputPrecisions, i), outputDims[i], TensorDesc::getLayoutByDims(outputDims[i]));
+            layer->outData.push_back(std::make_shared<Data>("out" + std::to_string(i), desc));
+            outputs.push_back(make_blob_with_precision(desc));
+            outputs.back()->allocate();
+        }
+
+        Extensions::Cpu::MKLDNNExtensions extensions;
+        ILayerImplFactory* factory = nullptr;
+        ResponseDesc resp;
+        if (extensions.getFactoryFor(factory, layer.get(), &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        std::unique_ptr<ILayerImplFactory> factoryHolder(factory);
+        std::vector<ILayerImpl::Ptr> impls;
+        if (factory->getImplementations(impls, &resp) != OK || impls.empty())
+            THROW_IE_EXCEPTION << resp.msg;
+        impl = std::dynamic_pointer_cast<ILayerExecImpl>(impls[0]);
+
+        std::vector<LayerConfig> configs;
+        if (impl->getSupportedConfigurations(configs, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+    }
+
+    template <typename T = float>
+    T* input(size_t i) { return inputs[i]->buffer().as<T*>(); }
+    template <typename T = float>
+    const T* output(size_t i) { return outputs[i]->cbuffer().as<const T*>(); }
+
+    InferenceEngine::StatusCode execute(InferenceEngine::ResponseDesc* resp = nullptr) {
+        InferenceEngine::ResponseDesc defaultResp;
+        return impl->execute(inputs, outputs, resp != nullptr ? resp : &defaultResp);
+    }
+
+    // average time of one execution in milliseconds
+    double benchmark(int iterations = 10) {
+        execute();
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            execute();
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(finish - start).count() / iterations;
+    }
+
+private:
+    InferenceEngine::CNNLayerPtr layer;
+    std::vector<InferenceEngine::DataPtr> inputData;
+    InferenceEngine::ILayerExecImpl::Ptr impl;
+    std::vector<InferenceEngine::Blob::Ptr> inputs;
+    std::vector<InferenceEngine::Blob::Ptr> outputs;
+};
+
+}  // namespace CPUUnitTestUtils
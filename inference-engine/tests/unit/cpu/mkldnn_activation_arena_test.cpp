@@ -0,0 +1,107 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_activation_arena.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(ActivationArenaTest, ReleasedBlockIsReused) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    void* data = nullptr;
+    {
+        auto block = arena->Acquire(1000);
+        ASSERT_GE(block->GetSize(), 1000);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(block->GetData()) % 64);
+        data = block->GetData();
+    }
+    // graphs executed one by one share a single block
+    for (size_t size : {1000, 10, 500}) {
+        auto block = arena->Acquire(size);
+        ASSERT_EQ(data, block->GetData());
+    }
+    ASSERT_EQ(1000, arena->GetAllocatedSize());
+}
+
+TEST(ActivationArenaTest, ConcurrentLeasesGetDifferentBlocks) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    auto first = arena->Acquire(100);
+    auto second = arena->Acquire(100);
+    ASSERT_NE(first->GetData(), second->GetData());
+    ASSERT_EQ(200, arena->GetAllocatedSize());
+}
+
+TEST(ActivationArenaTest, PreferredBlockIsReturnedIfItFits) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    auto small = arena->Acquire(100);
+    auto large = arena->Acquire(1000);
+    void* largeData = large->GetData();
+    small.reset();
+    large.reset();
+
+    // without a preference the smallest fitting block is returned
+    ASSERT_NE(largeData, arena->Acquire(50)->GetData());
+    ASSERT_EQ(largeData, arena->Acquire(50, largeData)->GetData());
+    ASSERT_EQ(largeData, arena->Acquire(500, nullptr)->GetData());
+}
+
+TEST(ActivationArenaTest, TooSmallBlockIsReplaced) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    arena->Acquire(100);
+    auto block = arena->Acquire(300);
+    ASSERT_GE(block->GetSize(), 300);
+    // the number of blocks is bounded by the number of concurrent leases
+    ASSERT_EQ(300, arena->GetAllocatedSize());
+}
+
+TEST(ActivationArenaTest, LargeBlocksAreAlignedToHugePages) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    const size_t hugePageSize = 2 * 1024 * 1024;
+    auto block = arena->Acquire(3 * hugePageSize);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(block->GetData()) % hugePageSize);
+    std::fill_n(static_cast<int8_t*>(block->GetData()), block->GetSize(), 1);
+}
+
+TEST(ActivationArenaTest, LeaseOutlivesArena) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    auto block = arena->Acquire(100);
+    arena.reset();
+    ASSERT_EQ(100, block->GetSize());
+}
+
+TEST(ActivationArenaTest, ConcurrentLeasesAreBounded) {
+    auto arena = std::make_shared<MKLDNNActivationArena>();
+    const size_t threadsNum = 4;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsNum; i++) {
+        threads.emplace_back([&, i] {
+            for (int iteration = 0; iteration < 1000; iteration++) {
+                auto block = arena->Acquire(128 * (i + 1));
+                static_cast<int8_t*>(block->GetData())[block->GetSize() - 1] = 1;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ASSERT_LE(arena->GetAllocatedSize(), 128 * threadsNum * threadsNum);
+}
+
+TEST(ActivationArenaTest, InstanceIsReleasedWithItsLastUser) {
+    auto arena = MKLDNNActivationArena::GetInstance();
+    ASSERT_EQ(arena, MKLDNNActivationArena::GetInstance());
+    std::weak_ptr<MKLDNNActivationArena> released = arena;
+    auto block = arena->Acquire(100);
+    arena.reset();
+    ASSERT_FALSE(released.expired());
+
+    // the free blocks are freed with the arena, a new user gets a new arena
+    block.reset();
+    ASSERT_TRUE(released.expired());
+    ASSERT_EQ(0, MKLDNNActivationArena::GetInstance()->GetAllocatedSize());
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_weights_cache.hpp"
+#include "details/ie_exception.hpp"
+
+using namespace MKLDNNPlugin;
+
+TEST(WeightsCacheTest, HashIsDeterministicAndDependsOnData) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    std::vector<unsigned char> data(1027);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<unsigned char>(i * 31);
+
+    const auto hash = hashFunc.hash(data.data(), data.size());
+    ASSERT_EQ(hash, hashFunc.hash(data.data(), data.size()));
+
+    // each tail length is processed by its own branch
+    for (size_t size : {0, 3, 4, 8, 31, 32, 1026}) {
+        ASSERT_NE(hash, hashFunc.hash(data.data(), size));
+    }
+
+    data[data.size() / 2] ^= 1;
+    ASSERT_NE(hash, hashFunc.hash(data.data(), data.size()));
+}
+
+TEST(WeightsCacheTest, HashMatchesReferenceValues) {
+    const auto& hashFunc = MKLDNNWeightsSharing::GetHashFunc();
+    ASSERT_EQ(0xef46db3751d8e999ULL, hashFunc.hash(nullptr, 0));
+    const std::string abc = "abc";
+    ASSERT_EQ(0x44bc2cf5ad770999ULL, hashFunc.hash(reinterpret_cast<const unsigned char*>(abc.data()), abc.size()));
+}
+
+TEST(WeightsCacheTest, ConcurrentRequestsCreateObjectOnce) {
+    MKLDNNWeightsSharing cache;
+    std::atomic<int> created{0};
+    std::vector<MKLDNNMemoryPtr> results(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++) {
+        threads.emplace_back([&, i] {
+            results[i] = cache.findOrCreate("weights", [&] {
+                created++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                return std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+            });
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(1, created);
+    for (auto& result : results)
+        ASSERT_EQ(results[0], result);
+}
+
+TEST(WeightsCacheTest, ReleasedObjectIsCreatedAgain) {
+    MKLDNNWeightsSharing cache;
+    int created = 0;
+    auto create = [&] {
+        created++;
+        return std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    };
+
+    auto memory = cache.findOrCreate("weights", create);
+    ASSERT_EQ(memory, cache.findOrCreate("weights", create));
+    ASSERT_EQ(1, created);
+
+    memory.reset();
+    ASSERT_NE(nullptr, cache.findOrCreate("weights", create));
+    ASSERT_EQ(2, created);
+}
+
+TEST(WeightsCacheTest, FailedCreationCanBeRetried) {
+    MKLDNNWeightsSharing cache;
+    ASSERT_THROW(cache.findOrCreate("weights", []() -> MKLDNNMemoryPtr {
+        THROW_IE_EXCEPTION << "Cannot create weights";
+    }), InferenceEngine::details::InferenceEngineException);
+
+    ASSERT_NE(nullptr, cache.findOrCreate("weights", [] {
+        return std::make_shared<MKLDNNMemory>(mkldnn::engine(mkldnn::engine::kind::cpu, 0));
+    }));
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/floatmath.h"
+#include "runtime/floatmath_kernels.hpp"
+
+using GNAPluginNS::runtime::GetFloatMathKernels;
+
+namespace {
+
+class GNAFloatMathGemmTest : public ::testing::TestWithParam<std::tuple<int, int, int>> {
+protected:
+    std::vector<float> Random(size_t size) {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> data(size);
+        for (auto&& value : data) {
+            value = distribution(generator);
+        }
+        return data;
+    }
+
+    std::mt19937 generator{42};
+};
+
+TEST_P(GNAFloatMathGemmTest, sgemmNoTransMatchesReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    const int lda = K + 3;
+    auto A = Random(M * lda);
+    auto B = Random(K * N);
+    auto C = Random(M * N);
+    auto expected = C;
+    for (int i = 0; i < M; i++) {
+        for (int j = 0; j < N; j++) {
+            double sum = expected[i * N + j];
+            for (int k = 0; k < K; k++) {
+                sum += static_cast<double>(A[i * lda + k]) * B[k * N + j];
+            }
+            expected[i * N + j] = static_cast<float>(sum);
+        }
+    }
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), lda, B.data(), N, 1.0f, C.data(), N);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-5f * (K + 1)) << "at " << i;
+    }
+}
+
+TEST_P(GNAFloatMathGemmTest, sgemmSubsetMatchesReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = Random(M * K);
+    auto B = Random(K * N);
+    std::vector<uint32_t> outputs;
+    for (int i = M - 1; i >= 0; i -= 2) {
+        outputs.push_back(i);
+    }
+    const int L = static_cast<int>(outputs.size());
+    std::vector<float> C(L * N, std::numeric_limits<float>::quiet_NaN());
+    std::vector<float> expected(L * N);
+    for (int l = 0; l < L; l++) {
+        for (int j = 0; j < N; j++) {
+            double sum = 0;
+            for (int k = 0; k < K; k++) {
+                sum += static_cast<double>(A[outputs[l] * K + k]) * B[k * N + j];
+            }
+            expected[l * N + j] = static_cast<float>(sum);
+        }
+    }
+
+    // C is overwritten if beta is not equal to 1
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K, B.data(), N,
+                       0.0f, C.data(), N, outputs.data(), L);
+
+    for (size_t i = 0; i < C.size(); i++) {
+        ASSERT_NEAR(expected[i], C[i], 1e-5f * (K + 1)) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAFloatMathGemmTest,
+                        ::testing::Combine(::testing::Values(1, 4, 7, 33),
+                                           ::testing::Values(1, 3, 8),
+                                           ::testing::Values(1, 15, 16, 67)));
+
+TEST(GNAFloatMathKernelsTest, activationsMatchReference) {
+    const auto& kernels = GetFloatMathKernels();
+    std::vector<float> input;
+    for (int i = -1000; i <= 1000; i++) {
+        input.push_back(i * 0.0125f);
+    }
+    std::vector<float> output(input.size());
+
+    kernels.tanh(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        ASSERT_NEAR(std::tanh(input[i]), output[i], 1e-6f) << "tanh(" << input[i] << ")";
+    }
+
+    kernels.sigmoid(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        ASSERT_NEAR(1.0f / (1.0f + std::exp(-input[i])), output[i], 1e-6f) << "sigmoid(" << input[i] << ")";
+    }
+}
+
+TEST(GNAFloatMathKernelsTest, elementwiseMatchScalarSemantics) {
+    const auto& kernels = GetFloatMathKernels();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> input{-60.0f, 60.0f, 0.0f, -0.0f, 3.0f, -3.0f, 1e-5f, -2.0f, 50.0f, -50.0f,
+                             49.5f, -49.5f, 7.0f, -7.0f, 0.5f, -0.5f, 100.0f, nan};
+    std::vector<float> output(input.size());
+
+    kernels.clamp(input.data(), output.data(), input.size(), -50.0f, 50.0f);
+    for (size_t i = 0; i + 1 < input.size(); i++) {
+        EXPECT_EQ(std::min(50.0f, std::max(-50.0f, input[i])), output[i]);
+    }
+    EXPECT_TRUE(std::isnan(output.back()));
+
+    kernels.leaky_relu(input.data(), output.data(), input.size(), 0.25f);
+    for (size_t i = 0; i + 1 < input.size(); i++) {
+        EXPECT_EQ(input[i] < 0.0f ? input[i] * 0.25f : input[i], output[i]);
+    }
+
+    kernels.sign(input.data(), output.data(), input.size());
+    for (size_t i = 0; i < input.size(); i++) {
+        EXPECT_EQ(input[i] == 0.0f ? 0.0f : (input[i] > 0.0f ? 1.0f : -1.0f), output[i]);
+    }
+
+    kernels.abs(input.data(), output.data(), input.size());
+    for (size_t i = 0; i + 1 < input.size(); i++) {
+        EXPECT_EQ(std::fabs(input[i]), output[i]);
+    }
+}
+
+TEST(GNAFloatMathKernelsTest, hostKernelsMatchScalarKernels) {
+    const auto& kernels = GetFloatMathKernels();
+    const auto& scalar = GNAPluginNS::runtime::scalar::GetFloatMathKernels();
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(-8.0f, 8.0f);
+    // not a multiple of any vector width, so both the vector body and the scalar tail are checked
+    const size_t size = 1003;
+    std::vector<float> a(size), b(size);
+    for (size_t i = 0; i < size; i++) {
+        a[i] = distribution(generator);
+        b[i] = distribution(generator);
+    }
+
+    std::vector<float> expected(size), actual(size);
+    // activations are fused the same way in every table, so the results are bit exact
+    scalar.tanh(a.data(), expected.data(), size);
+    kernels.tanh(a.data(), actual.data(), size);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(expected[i], actual[i]) << "tanh(" << a[i] << ")";
+    }
+
+    scalar.sigmoid(a.data(), expected.data(), size);
+    kernels.sigmoid(a.data(), actual.data(), size);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(expected[i], actual[i]) << "sigmoid(" << a[i] << ")";
+    }
+
+    std::fill(expected.begin(), expected.end(), 1.0f);
+    std::fill(actual.begin(), actual.end(), 1.0f);
+    scalar.diagonal(a.data(), b.data(), expected.data(), size);
+    kernels.diagonal(a.data(), b.data(), actual.data(), size);
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_NEAR(expected[i], actual[i], 1e-5f * std::fabs(expected[i]) + 1e-6f);
+    }
+
+    // summation order differs between the tables, the bound is relative to the sum of magnitudes
+    float magnitude = 0.0f;
+    for (size_t i = 0; i < size; i++) {
+        magnitude += std::fabs(a[i] * b[i]);
+    }
+    ASSERT_NEAR(scalar.dot(a.data(), b.data(), size), kernels.dot(a.data(), b.data(), size), 1e-5f * magnitude);
+}
+
+}  // namespace
@@ -32,6 +32,8 @@ public:
     void setRequestBusy() {
         AsyncInferRequestThreadSafeDefault::setIsRequestBusy(true);
     }
+
+    using AsyncInferRequestThreadSafeDefault::AddPreprocessingStage;
 };
 
 struct DeferedExecutor : public ITaskExecutor {
@@ -111,6 +113,42 @@ TEST_F(InferRequestThreadSafeDefaultTests, canResetBusyStatusIfStartAsyncFails)
     ASSERT_NO_THROW(mockAsync.StartAsync());
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, preprocessingStageRunsBeforeInferOnItsExecutor) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto preprocessingExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->AddPreprocessingStage(preprocessingExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, isPreprocessingRequired()).WillRepeatedly(Return(true));
+    {
+        InSequence s;
+        EXPECT_CALL(*mockInferRequestInternal, Preprocess()).Times(1);
+        EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1);
+    }
+
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_EQ(1, preprocessingExecutor->tasks.size());
+    ASSERT_TRUE(taskExecutor->tasks.empty());
+    preprocessingExecutor->executeAll();
+    ASSERT_EQ(1, taskExecutor->tasks.size());
+    taskExecutor->executeAll();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, preprocessingStageIsSkippedIfNotRequired) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto preprocessingExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    testRequest->AddPreprocessingStage(preprocessingExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, isPreprocessingRequired()).WillRepeatedly(Return(false));
+    EXPECT_CALL(*mockInferRequestInternal, Preprocess()).Times(0);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1);
+
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_TRUE(preprocessingExecutor->tasks.empty());
+    taskExecutor->executeAll();
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+}
+
 // GetUserData
 TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnGetUserData) {
     auto taskExecutor = std::make_shared<DeferedExecutor>();
@@ -0,0 +1,152 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "ie_network_cache.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+CNNNetwork makeNetwork(float scale) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    auto constant = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3, 1, 1},
+                                                     {1.0f, 2.0f, scale});
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(param, constant);
+    auto result = std::make_shared<ngraph::opset1::Result>(multiply);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Version makeVersion(const char* buildNumber) {
+    Version version;
+    version.apiVersion.major = 2;
+    version.apiVersion.minor = 1;
+    version.buildNumber = buildNumber;
+    version.description = "MockPlugin";
+    return version;
+}
+
+std::vector<std::string> listBlobs(const std::string& dir) {
+    std::vector<std::string> blobs;
+    DIR* dirHandle = opendir(dir.c_str());
+    if (dirHandle == nullptr) {
+        return blobs;
+    }
+    while (dirent* entry = readdir(dirHandle)) {
+        std::string name = entry->d_name;
+        if (CommonTestUtils::endsWith(name, ".blob")) {
+            blobs.push_back(CommonTestUtils::makePath(dir, name));
+        }
+    }
+    closedir(dirHandle);
+    return blobs;
+}
+
+}  // namespace
+
+class NetworkCacheTests : public ::testing::Test {
+protected:
+    std::string cacheDir = ::testing::UnitTest::GetInstance()->current_test_info()->name() + std::string("_cache");
+    const Version version = makeVersion("1");
+    const std::map<std::string, std::string> config = {{"PERF_COUNT", "NO"}};
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+        CommonTestUtils::removeDir(cacheDir);
+    }
+
+    void store(const NetworkCache& cache, const std::string& key, const std::string& content) {
+        cache.Store(key, [&](std::ostream& blob) {
+            blob << content;
+        });
+    }
+
+    bool load(const NetworkCache& cache, const std::string& key, std::string& content) {
+        return cache.Load(key, [&](std::istream& blob) {
+            std::stringstream data;
+            data << blob.rdbuf();
+            content = data.str();
+        });
+    }
+};
+
+TEST_F(NetworkCacheTests, keyIsStableForSameNetwork) {
+    ASSERT_EQ(NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, version),
+              NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, version));
+}
+
+TEST_F(NetworkCacheTests, keyDependsOnWeightsConfigAndVersions) {
+    auto key = NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, version);
+    ASSERT_NE(key, NetworkCache::ComputeKey(makeNetwork(4.0f), "CPU", config, version));
+    ASSERT_NE(key, NetworkCache::ComputeKey(makeNetwork(3.0f), "GPU", config, version));
+    ASSERT_NE(key, NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", {{"PERF_COUNT", "YES"}}, version));
+    ASSERT_NE(key, NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, makeVersion("2")));
+
+    auto network = makeNetwork(3.0f);
+    network.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    ASSERT_NE(key, NetworkCache::ComputeKey(network, "CPU", config, version));
+}
+
+TEST_F(NetworkCacheTests, storedNetworkIsLoaded) {
+    NetworkCache cache(cacheDir, 0);
+    auto key = NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, version);
+    store(cache, key, "compiled network");
+
+    std::string content;
+    ASSERT_TRUE(load(cache, key, content));
+    ASSERT_EQ("compiled network", content);
+}
+
+TEST_F(NetworkCacheTests, changedNetworkOrConfigMissesCache) {
+    NetworkCache cache(cacheDir, 0);
+    store(cache, NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, version), "compiled network");
+
+    std::string content;
+    ASSERT_FALSE(load(cache, NetworkCache::ComputeKey(makeNetwork(4.0f), "CPU", config, version), content));
+    ASSERT_FALSE(load(cache, NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", {{"PERF_COUNT", "YES"}}, version),
+                      content));
+    ASSERT_FALSE(load(cache, NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, makeVersion("2")), content));
+    ASSERT_TRUE(content.empty());
+}
+
+TEST_F(NetworkCacheTests, blobOfAnotherKeyIsNotImported) {
+    NetworkCache cache(cacheDir, 0);
+    auto oldKey = NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, version);
+    auto newKey = NetworkCache::ComputeKey(makeNetwork(3.0f), "CPU", config, makeVersion("2"));
+    store(cache, newKey, "new plugin network");
+    auto newBlobs = listBlobs(cacheDir);
+    ASSERT_EQ(1u, newBlobs.size());
+    store(cache, oldKey, "old plugin network");
+    auto blobs = listBlobs(cacheDir);
+    ASSERT_EQ(2u, blobs.size());
+    auto oldBlob = blobs[0] == newBlobs[0] ? blobs[1] : blobs[0];
+
+    // a blob under the name of the key, e.g. a hash collision, must not be passed to the reader
+    ASSERT_EQ(0, std::remove(newBlobs[0].c_str()));
+    ASSERT_EQ(0, std::rename(oldBlob.c_str(), newBlobs[0].c_str()));
+    bool readerCalled = false;
+    ASSERT_FALSE(cache.Load(newKey, [&](std::istream&) {
+        readerCalled = true;
+    }));
+    ASSERT_FALSE(readerCalled);
+
+    // the network compiled again replaces the blob
+    store(cache, newKey, "new plugin network");
+    std::string content;
+    ASSERT_TRUE(load(cache, newKey, content));
+    ASSERT_EQ("new plugin network", content);
+}
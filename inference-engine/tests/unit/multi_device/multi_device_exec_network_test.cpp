@@ -0,0 +1,276 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <multi-device/multi_device_config.hpp>
+
+#include "multi_device_exec_network.hpp"
+#include "unit_test_utils/mocks/mock_iexecutable_network.hpp"
+#include "unit_test_utils/mocks/mock_iinfer_request.hpp"
+
+using namespace MultiDevicePlugin;
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+TEST(ThreadSafeBoundedQueueTests, pushFailsWhenFullAndPopFailsWhenEmpty) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(i, value);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(ThreadSafeBoundedQueueTests, closedQueueRejectsValues) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(4);
+    queue.set_capacity(0);
+    ASSERT_FALSE(queue.try_push(0));
+}
+
+TEST(ThreadSafeBoundedQueueTests, concurrentProducersAndConsumersPassEveryValueOnce) {
+    const int numProducers = 4, numConsumers = 4, numValuesPerProducer = 100000;
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(8);
+
+    std::vector<std::atomic<int>> received(numProducers * numValuesPerProducer);
+    for (auto&& count : received) {
+        count = 0;
+    }
+    std::atomic<int> numReceived = {0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < numProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = p * numValuesPerProducer; i < (p + 1) * numValuesPerProducer; ++i) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < numConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (numReceived.load() < numProducers * numValuesPerProducer) {
+                int value = -1;
+                if (queue.try_pop(value)) {
+                    ++received[value];
+                    ++numReceived;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i < received.size(); ++i) {
+        ASSERT_EQ(1, received[i].load()) << "value: " << i;
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+// The MULTI device uses the queue as a pool of idle worker requests: a request is taken by one thread at a time
+// and is always returned, so the queue is never overfilled
+TEST(ThreadSafeBoundedQueueTests, concurrentPoolUsersOwnItemsExclusively) {
+    const int numItems = 4, numThreads = 8, numIterations = 100000;
+    ThreadSafeBoundedQueue<std::atomic<bool>*> queue;
+    queue.set_capacity(numItems);
+    std::vector<std::atomic<bool>> busy(numItems);
+    for (auto&& item : busy) {
+        item = false;
+        ASSERT_TRUE(queue.try_push(&item));
+    }
+
+    std::atomic<int> numConflicts = {0}, numFailedPushes = {0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < numIterations; ++i) {
+                std::atomic<bool>* item = nullptr;
+                while (!queue.try_pop(item)) {
+                    std::this_thread::yield();
+                }
+                if (item->exchange(true)) {
+                    ++numConflicts;
+                }
+                item->store(false);
+                if (!queue.try_push(item)) {
+                    ++numFailedPushes;
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, numConflicts.load());
+    ASSERT_EQ(0, numFailedPushes.load());
+    std::atomic<bool>* item = nullptr;
+    for (int i = 0; i < numItems; ++i) {
+        ASSERT_TRUE(queue.try_pop(item));
+    }
+    ASSERT_FALSE(queue.try_pop(item));
+}
+
+class MultiDeviceSchedulingTests : public ::testing::Test {
+protected:
+    // Device requests are never started, a test completes them by calling the callback set by the MULTI device
+    struct FakeRequest {
+        std::string device;
+        std::shared_ptr<NiceMock<MockIInferRequest>> request;
+        void* userData = nullptr;
+        IInferRequest::CompletionCallback callback = nullptr;
+    };
+    std::map<IInferRequest*, std::shared_ptr<FakeRequest>> fakeRequests;
+    std::vector<std::shared_ptr<NiceMock<MockIExecutableNetwork>>> deviceNetworks;
+
+    ExecutableNetwork makeDeviceNetwork(const std::string& device, unsigned int numRequests) {
+        auto network = std::make_shared<NiceMock<MockIExecutableNetwork>>();
+        ON_CALL(*network, GetMetric(_, _, _)).WillByDefault(Invoke(
+            [numRequests](const std::string& name, Parameter& result, ResponseDesc*) {
+                if (name != METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+                    return NOT_IMPLEMENTED;
+                }
+                result = numRequests;
+                return OK;
+            }));
+        ON_CALL(*network, CreateInferRequest(_, _)).WillByDefault(Invoke(
+            [this, device](IInferRequest::Ptr& request, ResponseDesc*) {
+                auto fake = std::make_shared<FakeRequest>();
+                fake->device = device;
+                fake->request = std::make_shared<NiceMock<MockIInferRequest>>();
+                FakeRequest* fakePtr = fake.get();
+                ON_CALL(*fake->request, SetUserData(_, _)).WillByDefault(Invoke([fakePtr](void* data, ResponseDesc*) {
+                    fakePtr->userData = data;
+                    return OK;
+                }));
+                ON_CALL(*fake->request, GetUserData(_, _)).WillByDefault(Invoke([fakePtr](void** data, ResponseDesc*) {
+                    *data = fakePtr->userData;
+                    return OK;
+                }));
+                ON_CALL(*fake->request, SetCompletionCallback(_)).WillByDefault(Invoke(
+                    [fakePtr](IInferRequest::CompletionCallback callback) {
+                        fakePtr->callback = callback;
+                        return OK;
+                    }));
+                request = fake->request;
+                fakeRequests[request.get()] = fake;
+                return OK;
+            }));
+        deviceNetworks.push_back(network);
+        return ExecutableNetwork(network);
+    }
+
+    // The devices are listed in priority order, each with the number of its requests
+    std::shared_ptr<MultiDeviceExecutableNetwork> makeMultiNetwork(
+            const std::vector<std::pair<std::string, unsigned int>>& devices, const std::string& policy) {
+        DeviceMap<ExecutableNetwork> networks;
+        std::vector<DeviceInformation> priorities;
+        for (auto&& device : devices) {
+            networks[device.first] = makeDeviceNetwork(device.first, device.second);
+            priorities.push_back({device.first, {}, -1});
+        }
+        return std::make_shared<MultiDeviceExecutableNetwork>(networks, priorities,
+            std::unordered_map<std::string, Parameter>{{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, policy}});
+    }
+
+    // Schedules a request the same way as MultiDeviceAsyncInferRequest does and returns the fake device request
+    // it was given to, the request is started serviceTime ago. Returns nullptr if no device request is idle.
+    FakeRequest* schedule(MultiDeviceExecutableNetwork& network, std::chrono::microseconds serviceTime) {
+        MultiDeviceExecutableNetwork::WorkerInferRequest* worker = nullptr;
+        network.run([&] {
+            worker = MultiDeviceExecutableNetwork::_thisWorkerInferRequest;
+            worker->_task = [] {};
+            worker->_startTime = std::chrono::steady_clock::now() - serviceTime;
+            worker->_statistics->OnStarted();
+        });
+        if (nullptr == worker) {
+            return nullptr;
+        }
+        IInferRequest::Ptr& request = worker->_inferRequest;
+        return fakeRequests.at(request.get()).get();
+    }
+
+    void complete(FakeRequest* fake) {
+        fake->callback(fake->request, OK);
+    }
+
+    void TearDown() override {
+        fakeRequests.clear();
+        deviceNetworks.clear();
+    }
+};
+
+TEST_F(MultiDeviceSchedulingTests, devicePriorityPolicyUsesFirstIdleDevice) {
+    auto network = makeMultiNetwork({{"SLOW", 2}, {"FAST", 2}}, MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY);
+
+    complete(schedule(*network, std::chrono::milliseconds(40)));
+    auto second = schedule(*network, std::chrono::milliseconds(1));
+    ASSERT_EQ("SLOW", second->device);
+    complete(second);
+
+    ASSERT_EQ("SLOW", schedule(*network, std::chrono::milliseconds(40))->device);
+    ASSERT_EQ("SLOW", schedule(*network, std::chrono::milliseconds(40))->device);
+    ASSERT_EQ("FAST", schedule(*network, std::chrono::milliseconds(1))->device);
+}
+
+TEST_F(MultiDeviceSchedulingTests, leastOutstandingPolicyUsesDeviceWithLeastExpectedTime) {
+    auto network = makeMultiNetwork({{"SLOW", 4}, {"FAST", 4}}, MultiDeviceConfigParams::MULTI_LEAST_OUTSTANDING);
+
+    // devices without statistics are equally fast, so the priority order is kept
+    auto first = schedule(*network, std::chrono::milliseconds(40));
+    ASSERT_EQ("SLOW", first->device);
+    complete(first);
+
+    // the slow device is expected to take 40 ms / 4 requests, the fast one is not measured yet
+    auto second = schedule(*network, std::chrono::milliseconds(1));
+    ASSERT_EQ("FAST", second->device);
+    complete(second);
+
+    // the fast device is expected to finish (in flight + 1) * 1 ms / 4 requests, which is less than 10 ms
+    // until all of its requests are busy
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ("FAST", schedule(*network, std::chrono::milliseconds(1))->device) << "request: " << i;
+    }
+    ASSERT_EQ("SLOW", schedule(*network, std::chrono::milliseconds(40))->device);
+}
+
+TEST_F(MultiDeviceSchedulingTests, policyIsChangedBySetConfig) {
+    auto network = makeMultiNetwork({{"SLOW", 4}, {"FAST", 4}}, MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY);
+    complete(schedule(*network, std::chrono::milliseconds(40)));
+    auto second = schedule(*network, std::chrono::milliseconds(1));
+    ASSERT_EQ("SLOW", second->device);
+    complete(second);
+
+    network->SetConfig({{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                         std::string(MultiDeviceConfigParams::MULTI_LEAST_OUTSTANDING)}});
+    ASSERT_EQ("FAST", schedule(*network, std::chrono::milliseconds(1))->device);
+
+    ASSERT_THROW(network->SetConfig({{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, std::string("FASTEST")}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
@@ -6,6 +6,7 @@
 #include "mkldnn_exec_network.h"
 
 #include "tests_common.hpp"
+#include <blob_factory.hpp>
 #include <ie_core.hpp>
 #include <legacy/details/ie_cnn_network_iterator.hpp>
 
@@ -6692,3 +6693,148 @@ TEST_F(MKLDNNGraphStructureTests, TestConcatWithFourInputs) {
 
     compare(*outputBlobs["concat"], *dstOut);
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestConcatOutputIsWrittenToBoundBuffer) {
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv_a" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="8" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="0" size="256"/>
+            <biases offset="256" size="32"/>
+        </layer>
+        <layer name="conv_b" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="8" group="1"/>
+            <input>
+                <port id="3">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+            <weights offset="288" size="256"/>
+            <biases offset="544" size="32"/>
+        </layer>
+        <layer name="concat" type="Concat" precision="FP32" id="3">
+            <concat_data axis="1"/>
+            <input>
+                <port id="5">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="6">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="7">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>4</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        <edge from-layer="1" from-port="2" to-layer="3" to-port="5"/>
+        <edge from-layer="2" from-port="4" to-layer="3" to-port="6"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+            { InferenceEngine::Precision::U8, {576}, InferenceEngine::C });
+    weights->allocate();
+    fill_data(weights->buffer().as<float *>(), weights->size() / sizeof(float));
+
+    InferenceEngine::Core core;
+    InferenceEngine::CNNNetwork network;
+    ASSERT_NO_THROW(network = core.ReadNetwork(model, weights));
+
+    MKLDNNGraphTestClass graph;
+    graph.CreateGraph(network);
+
+    InferenceEngine::TensorDesc srcDesc(InferenceEngine::Precision::FP32, {1, 8, 4, 4}, InferenceEngine::NCHW);
+    InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(srcDesc);
+    src->allocate();
+    fill_data(src->buffer().as<float *>(), src->size());
+    InferenceEngine::BlobMap srcs = {{"data", src}};
+
+    const std::string outName = network.getOutputsInfo().begin()->first;
+    ASSERT_EQ(1u, graph.GetOutputNodes().size());
+    auto outEdge = graph.GetOutputNodes()[0]->getParentEdgeAt(0);
+    // the buffer has the layout the producer writes in, so it can be bound
+    const InferenceEngine::TensorDesc outDesc = outEdge->getDesc();
+    ASSERT_TRUE(graph.CanBindOutputPtr(outName, outDesc));
+
+    InferenceEngine::Blob::Ptr ref = make_blob_with_precision(outDesc);
+    ref->allocate();
+    InferenceEngine::BlobMap refs = {{outName, ref}};
+    graph.Infer(srcs, refs);
+
+    InferenceEngine::Blob::Ptr dst = make_blob_with_precision(outDesc);
+    dst->allocate();
+    void *dstPtr = dst->buffer();
+    graph.BindOutputPtr(outName, dstPtr);
+    InferenceEngine::BlobMap dsts = {{outName, dst}};
+    graph.Infer(srcs, dsts);
+
+    ASSERT_EQ(dstPtr, outEdge->getMemory().GetData());
+    for (auto &node : graph.getNodes()) {
+        // inputs of an optimized concat are views on its output, so the convolutions write to the bound buffer
+        if (node->getType() == MKLDNNPlugin::Concatenation &&
+            node->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].inPlace >= 0) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                ASSERT_EQ(dstPtr, node->getParentEdgeAt(i)->getMemory().GetData());
+            }
+        }
+    }
+    compare(*dst, *ref);
+
+    // memory of the graph is used again when the buffer is unbound
+    graph.BindOutputPtr(outName, nullptr);
+    ASSERT_NE(dstPtr, outEdge->getMemory().GetData());
+}
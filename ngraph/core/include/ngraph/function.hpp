@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -100,6 +101,8 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns the nodes in topological order. The order is cached and computed again
+        ///        only after the connections of the nodes or the function outputs are changed.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -175,6 +178,8 @@ namespace ngraph
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
 
+        void invalidate_ordered_ops() const;
+
         static std::atomic<size_t> m_next_instance_id;
         std::string m_name;
         const std::string m_unique_name;
@@ -187,6 +192,14 @@ namespace ngraph
         // These nodes are not outputs of graph but should not be removed even if have no children.
         SinkVector m_sinks;
         ParameterVector m_parameters;
+
+        // Order of the nodes and its validity flag, which is shared with the ordered nodes, so that
+        // changes of their connections reset it. The nodes are not owned, so the cache doesn't keep
+        // removed nodes connected to the graph.
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_ordered_ops;
+        const std::shared_ptr<std::atomic<bool>> m_ordered_ops_valid =
+            std::make_shared<std::atomic<bool>>(false);
     };
 
     template <>
@@ -465,6 +465,15 @@ namespace ngraph
         virtual bool match_node(pattern::Matcher* matcher, const Output<Node>& graph_value);
 
     private:
+        friend class Function;
+        /// \brief Shares the validity flag of the topological order of a function with the nodes
+        ///        of the order.
+        static void add_topology_cache(const std::vector<std::shared_ptr<Node>>& nodes,
+                                       const std::shared_ptr<std::atomic<bool>>& valid);
+        /// \brief Marks the topological orders of the functions containing the node as invalid,
+        ///        called whenever an input of the node is connected to another output or a control
+        ///        dependency of the node is added or removed.
+        void invalidate_topology_caches();
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
@@ -478,6 +487,9 @@ namespace ngraph
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
+        // Validity flags of the topological orders of the functions the node was ordered in, the
+        // flags are not owned so that they don't outlive the functions
+        std::vector<std::weak_ptr<std::atomic<bool>>> m_topology_caches;
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
@@ -25,7 +25,8 @@ namespace ngraph
         /**
          * @brief Constant folding iterates over the function and tries to evaluate nodes
          *        with constant inputs. Such nodes are then replaced with new Constants containing
-         *        the result of a folded operation.
+         *        the result of a folded operation. Independent nodes with constant inputs are
+         *        folded concurrently.
          */
         class NGRAPH_API ConstantFolding : public FunctionPass
         {
@@ -34,6 +35,8 @@ namespace ngraph
             bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
         private:
+            bool replace_outputs(const std::shared_ptr<Node>& node,
+                                 const OutputVector& replacements);
             void copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                     const Output<Node>& replacement);
         };
@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Splits the range [0, work_amount) into chunks and calls func(begin, end) for
+        ///        them on up to get_parallel_threads_limit() threads.
+        ///
+        /// Chunks have at least min_chunk items, so a small amount of work runs in the calling
+        /// thread. Calls from inside func run sequentially. Each item is processed by exactly
+        /// one call, so kernels that compute every output item on its own stay deterministic.
+        /// The first exception thrown by func is rethrown after all the threads are finished.
+        /// The calling thread processes chunks as well, the other ones are taken from a pool
+        /// of worker threads, which are started on first use and shared by all the callers.
+        ///
+        /// \param work_amount Number of items.
+        /// \param min_chunk Minimal number of items worth running in a separate thread.
+        /// \param func Functor processing the items of the range [begin, end).
+        NGRAPH_API
+        void parallel_for(size_t work_amount,
+                          size_t min_chunk,
+                          const std::function<void(size_t begin, size_t end)>& func);
+
+        /// \return Number of threads parallel_for calls of the current thread may use.
+        NGRAPH_API
+        size_t get_parallel_threads_limit();
+
+        /// \brief Limits the number of threads used by parallel_for calls of the current thread
+        ///        while the object exists.
+        ///
+        /// Plugins set it to the number of threads given to a stream, so nGraph does not start
+        /// more threads than the plugin is configured to use.
+        class NGRAPH_API ParallelThreadsLimit
+        {
+        public:
+            /// \param threads_limit Number of threads, 0 means the number of hardware threads.
+            explicit ParallelThreadsLimit(size_t threads_limit);
+            ~ParallelThreadsLimit();
+
+            ParallelThreadsLimit(const ParallelThreadsLimit&) = delete;
+            ParallelThreadsLimit& operator=(const ParallelThreadsLimit&) = delete;
+
+        private:
+            size_t m_previous_limit;
+        };
+    }
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 
 #include <utility>
@@ -95,6 +97,75 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                // Strides to walk over an argument broadcast to the output, the argument shape is
+                // aligned with the output one and the broadcast axes have zero strides
+                inline Strides broadcast_strides(const Shape& arg_padded_shape)
+                {
+                    Strides strides = ngraph::row_major_strides(arg_padded_shape);
+                    for (size_t i = 0; i < arg_padded_shape.size(); i++)
+                    {
+                        if (arg_padded_shape[i] == 1)
+                        {
+                            strides[i] = 0;
+                        }
+                    }
+                    return strides;
+                }
+
+                // Calls func(out_index, arg_indices) for every element of the output in the
+                // row-major order, arg_indices[k] is the index of the element of the k-th
+                // argument broadcast to it
+                template <size_t N, typename Functor>
+                void for_each_broadcast(const Shape& output_shape,
+                                        const std::array<Strides, N>& arg_strides,
+                                        Functor func)
+                {
+                    const size_t output_size = shape_size(output_shape);
+                    std::array<size_t, N> arg_indices{};
+                    if (output_size == 0)
+                    {
+                        return;
+                    }
+                    if (output_shape.empty())
+                    {
+                        func(0, arg_indices);
+                        return;
+                    }
+
+                    const size_t rank = output_shape.size();
+                    const size_t inner_size = output_shape.back();
+                    Coordinate outer_coord(rank, 0);
+                    std::array<size_t, N> arg_bases{};
+                    for (size_t out_index = 0; out_index < output_size; out_index += inner_size)
+                    {
+                        for (size_t i = 0; i < inner_size; i++)
+                        {
+                            for (size_t k = 0; k < N; k++)
+                            {
+                                arg_indices[k] = arg_bases[k] + i * arg_strides[k].back();
+                            }
+                            func(out_index + i, arg_indices);
+                        }
+                        // Advance the coordinate along the outer axes
+                        for (size_t axis = rank - 1; axis-- > 0;)
+                        {
+                            for (size_t k = 0; k < N; k++)
+                            {
+                                arg_bases[k] += arg_strides[k][axis];
+                            }
+                            if (++outer_coord[axis] < output_shape[axis])
+                            {
+                                break;
+                            }
+                            for (size_t k = 0; k < N; k++)
+                            {
+                                arg_bases[k] -= arg_strides[k][axis] * output_shape[axis];
+                            }
+                            outer_coord[axis] = 0;
+                        }
+                    }
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -264,25 +335,21 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
-                    // We'll be using CoordinateTransform to handle the broadcasting. No need to
-                    // process arg0 and output shape will be the same as arg0. We need to process
-                    // arg1 and the general procedure is as follows:
+                    // No need to process arg0 and output shape will be the same as arg0. We need
+                    // to process arg1 and the general procedure is as follows:
                     //
                     // (1) Trim trailing ones from arg1 shape.
                     // (2) Left and right pad arg1 to match arg0 shape. Axis is the index start
                     //     to align between arg0 and arg1.
-                    // (3) Squeeze (remove ones from) arg1 shape, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast arg1 to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     23.
+                    // (3) Broadcast arg1 to the final output shape walking it with zero strides
+                    //     along the axes of size 1.
                     //
                     // Example:
                     //
-                    //    Input shape->   Padded shape->   Squeezed Shape/Squeezed Axes
+                    //    Input shape->   Padded shape->   Strides
                     //    -----------  ------------  ----------------------------
-                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [ 3, 4, 5, 6]
-                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [    4, 5   ]     {0,3}
+                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [120, 30, 6, 1]
+                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [  0,  5, 1, 0]
                     //                      |  |  |
                     //                      v  v  v
                     //                     Output shape
@@ -312,32 +379,13 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
                         }
 
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg1_squeezed_axes;
-
-                        for (size_t i = 0; i < arg0_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(arg0_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes, false);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(output_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        internal::for_each_broadcast<1>(
+                            arg0_shape,
+                            {internal::broadcast_strides(arg1_padded_shape)},
+                            [&](size_t out_index, const std::array<size_t, 1>& arg_indices) {
+                                out[out_index] =
+                                    elementwise_functor(arg0[out_index], arg1[arg_indices[0]]);
+                            });
                     }
                 }
             }
@@ -407,63 +455,24 @@ namespace ngraph
                             arg2_padded_shape.insert(arg2_padded_shape.begin(), 1);
                         }
 
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        Shape arg2_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        AxisSet arg2_squeezed_axes;
                         Shape output_shape;
-
                         for (size_t i = 0; i < max_shape_size; i++)
                         {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-
-                            if (arg2_padded_shape[i] == 1)
-                            {
-                                arg2_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg2_squeezed_shape.push_back(arg2_padded_shape[i]);
-                            }
-
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
                             output_shape.push_back(std::max({arg0_padded_shape[i],
                                                              arg2_padded_shape[i],
                                                              arg1_padded_shape[i]}));
                         }
 
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform arg2_transform(arg2_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes, false);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes, false);
-                            Coordinate arg2_coord = reduce(output_coord, arg2_squeezed_axes, false);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)],
-                                                    arg2[arg2_transform.index(arg2_coord)]);
-                        }
+                        internal::for_each_broadcast<3>(
+                            output_shape,
+                            {internal::broadcast_strides(arg0_padded_shape),
+                             internal::broadcast_strides(arg1_padded_shape),
+                             internal::broadcast_strides(arg2_padded_shape)},
+                            [&](size_t out_index, const std::array<size_t, 3>& arg_indices) {
+                                out[out_index] = elementwise_functor(arg0[arg_indices[0]],
+                                                                     arg1[arg_indices[1]],
+                                                                     arg2[arg_indices[2]]);
+                            });
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
@@ -508,45 +517,14 @@ namespace ngraph
                         arg2_padded_shape.insert(arg2_padded_shape.end(), 1);
                     }
 
-                    Shape arg0_squeezed_shape;
-                    AxisSet arg0_squeezed_axes;
-                    Shape arg2_squeezed_shape;
-                    AxisSet arg2_squeezed_axes;
-
-                    for (size_t i = 0; i < arg1_shape.size(); i++)
-                    {
-                        if (arg0_padded_shape[i] == 1)
-                        {
-                            arg0_squeezed_axes.insert(i);
-                        }
-                        else
-                        {
-                            arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                        }
-                        if (arg2_padded_shape[i] == 1)
-                        {
-                            arg2_squeezed_axes.insert(i);
-                        }
-                        else
-                        {
-                            arg2_squeezed_shape.push_back(arg2_padded_shape[i]);
-                        }
-                    }
-
-                    CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                    CoordinateTransform arg1_transform(arg1_shape);
-                    CoordinateTransform arg2_transform(arg2_squeezed_shape);
-                    CoordinateTransform output_transform(arg1_shape);
-
-                    for (const Coordinate& output_coord : output_transform)
-                    {
-                        Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes, false);
-                        Coordinate arg2_coord = reduce(output_coord, arg2_squeezed_axes, false);
-                        out[output_transform.index(output_coord)] =
-                            elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                arg1[arg1_transform.index(output_coord)],
-                                                arg2[arg2_transform.index(arg2_coord)]);
-                    }
+                    internal::for_each_broadcast<2>(
+                        arg1_shape,
+                        {internal::broadcast_strides(arg0_padded_shape),
+                         internal::broadcast_strides(arg2_padded_shape)},
+                        [&](size_t out_index, const std::array<size_t, 2>& arg_indices) {
+                            out[out_index] = elementwise_functor(
+                                arg0[arg_indices[0]], arg1[out_index], arg2[arg_indices[1]]);
+                        });
                 }
                 }
             }
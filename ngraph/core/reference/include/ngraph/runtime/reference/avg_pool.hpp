@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <numeric>
@@ -24,7 +25,10 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/utils/sliding_window.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
 
 namespace ngraph
 {
@@ -134,118 +138,71 @@ namespace ngraph
             {
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (N,chan,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[0];
-                    size_t channel = out_coord[1];
-
-                    // For the input data we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
-                    //
-                    // with unit stride.
-                    //
-                    // We iterate this over the *padded* data, so below we will need to check for
-                    // coordinates that fall in the padding area.
-
-                    size_t n_spatial_dimensions = arg_shape.size() - 2;
-
-                    Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-                    Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-                    Strides input_batch_transform_source_strides(2 + n_spatial_dimensions, 1);
-                    AxisVector input_batch_transform_source_axis_order(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions);
-
-                    input_batch_transform_start[0] = batch_index;
-                    input_batch_transform_end[0] = batch_index + 1;
-                    input_batch_transform_start[1] = channel;
-                    input_batch_transform_end[1] = channel + 1;
-                    input_batch_transform_padding_below[0] = 0;
-                    input_batch_transform_padding_below[1] = 0;
-                    input_batch_transform_padding_above[0] = 0;
-                    input_batch_transform_padding_above[1] = 0;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        size_t window_shape_this_dim = window_shape[i - 2];
-                        size_t movement_stride = window_movement_strides[i - 2];
-
-                        input_batch_transform_start[i] = movement_stride * out_coord[i];
-                        input_batch_transform_end[i] =
-                            input_batch_transform_start[i] + window_shape_this_dim;
-                        input_batch_transform_padding_below[i] = padding_below[i - 2];
-                        input_batch_transform_padding_above[i] = padding_above[i - 2];
-                    }
-
-                    for (size_t i = 0; i < arg_shape.size(); i++)
-                    {
-                        input_batch_transform_source_axis_order[i] = i;
-                    }
-
-                    CoordinateTransform input_batch_transform(
-                        arg_shape,
-                        input_batch_transform_start,
-                        input_batch_transform_end,
-                        input_batch_transform_source_strides,
-                        input_batch_transform_source_axis_order,
-                        input_batch_transform_padding_below,
-                        input_batch_transform_padding_above);
-
-                    // As we go, we compute the sum value:
-                    //
-                    //   output[O] := output[O] + arg[I]
-                    //
-                    // and the number of elements:
-                    //
-                    //   n_elements := n_elements + 1
-
-                    T result = 0;
-                    size_t n_elements = 0;
-
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
-                    {
-                        bool in_bounds =
-                            input_batch_transform.has_source_coordinate(input_batch_coord);
-
-                        if (in_bounds || include_padding_in_avg_computation)
+                // For every output coordinate O = (N,chan,i_1,...,i_n) we compute the sum value
+                //
+                //   output[O] := output[O] + arg[I]
+                //
+                // and the number of elements over the input coordinates
+                // I = (N,chan,s_1*i_1+w_1,...,s_n*i_n+w_n) of the window (w_1,...,w_n), taken
+                // within the *padded* data. The window positions which fall into the padding area
+                // add zeros, so they only count if the padding is included.
+                const Strides arg_strides = row_major_strides(arg_shape);
+                const Strides out_strides = row_major_strides(out_shape);
+                const size_t n_spatial_dimensions = arg_shape.size() - 2;
+                const SlidingWindow window(
+                    Shape(arg_shape.begin() + 2, arg_shape.end()),
+                    Strides(arg_strides.begin() + 2, arg_strides.end()),
+                    window_shape,
+                    Strides(n_spatial_dimensions, 0),
+                    Shape(out_shape.begin() + 2, out_shape.end()),
+                    window_movement_strides,
+                    Strides(n_spatial_dimensions, 1),
+                    CoordinateDiff(padding_below.begin(), padding_below.end()),
+                    Strides(n_spatial_dimensions, 1));
+
+                parallel_for(
+                    shape_size(out_shape),
+                    (1 << 14) / std::max<size_t>(shape_size(window_shape), 1),
+                    [&](size_t begin, size_t end) {
+                        Coordinate out_coord(out_shape.size());
+                        for (size_t out_index = begin; out_index < end; out_index++)
                         {
-                            T v = in_bounds ? arg[input_batch_transform.index(input_batch_coord)]
-                                            : static_cast<T>(0);
-                            result += v;
-                            n_elements++;
+                            for (size_t i = 0; i < out_coord.size(); i++)
+                            {
+                                out_coord[i] = out_index / out_strides[i] % out_shape[i];
+                            }
+                            const T* arg_channel =
+                                arg + out_coord[0] * arg_strides[0] + out_coord[1] * arg_strides[1];
+
+                            T result = 0;
+                            size_t n_elements = 0;
+                            window.for_each(out_coord, [&](size_t, size_t arg_offset) {
+                                result += arg_channel[arg_offset];
+                                n_elements++;
+                            });
+                            if (include_padding_in_avg_computation)
+                            {
+                                n_elements = shape_size(window_shape);
+                            }
+
+                            if (n_elements == 0)
+                            {
+                                throw std::runtime_error(
+                                    "AvgPool elements == 0, must be non-zero");
+                            }
+
+                            if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
+                            {
+                                out[out_index] = static_cast<T>(
+                                    std::nearbyint(static_cast<float>(result) / n_elements));
+                            }
+                            else
+                            {
+                                out[out_index] = result / n_elements;
+                            }
                         }
-                    }
-
-                    if (n_elements == 0)
-                    {
-                        throw std::runtime_error("AvgPool elements == 0, must be non-zero");
-                    }
-
-                    if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
-                    {
-                        out[output_transform.index(out_coord)] =
-                            static_cast<T>(std::nearbyint(static_cast<float>(result) / n_elements));
-                    }
-                    else
-                    {
-                        out[output_transform.index(out_coord)] = result / n_elements;
-                    }
-                    std::fesetround(old_mode);
-                }
+                    });
+                std::fesetround(old_mode);
             }
         }
     }
@@ -23,9 +23,11 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/split.hpp"
+#include "ngraph/runtime/reference/utils/sliding_window.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -85,159 +87,77 @@ namespace ngraph
                 // * in channel axes for both in and filter are 1
                 // * out channel axes for filter is 0
                 // * out channel axis for out is 1
-
-                // At the outermost level we will walk over every out coordinate O.
-                CoordinateTransform out_transform(out_shape);
-
-                for (const Coordinate& out_coord : out_transform)
-                {
-                    // Our out coordinate O will have the form:
-                    //
-                    //   (N,chan_out,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[out_batch_axis];
-                    size_t out_channel = out_coord[out_channel_axis];
-
-                    // For the in we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,0,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,
-                    //      chans_in_count,
-                    //      s_1*i_1+ l_1*filter_dims_1,
-                    ///       ...,
-                    ///     s_n*i_n +l_n*filter_dims_n)
-                    //
-                    // with strides:
-                    //
-                    //   (1,l_1,...,l_n).
-                    //
-                    // Note that we are iterating within the *padded* and *dilated* in batch, so
-                    // further down we must check the current coordinate is in the pad or dilation
-                    // gap.
-
-                    size_t n_spatial_dimensions = in_shape.size() - 2;
-                    size_t n_in_channels = in_shape[in_channel_axis];
-
-                    Coordinate in_transform_start(2 + n_spatial_dimensions);
-                    Coordinate in_transform_end(2 + n_spatial_dimensions);
-                    Strides in_transform_movement_strides(2 + n_spatial_dimensions, 1);
-                    CoordinateDiff in_transform_pad_below(2 + n_spatial_dimensions, 0);
-                    CoordinateDiff in_transform_pad_above(2 + n_spatial_dimensions, 0);
-                    Strides in_transform_dilation_strides(2 + n_spatial_dimensions, 1);
-
-                    in_transform_start[in_batch_axis] = batch_index;
-                    in_transform_end[in_batch_axis] = batch_index + 1;
-                    in_transform_start[in_channel_axis] = 0;
-                    in_transform_end[in_channel_axis] = 1;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        size_t filter_dilation_stride = filter_dilation[i - 2];
-                        size_t filter_movement_stride = stride[i - 2];
-                        std::ptrdiff_t below_pad = in_pad_below[i - 2];
-                        std::ptrdiff_t above_pad = in_pad_above[i - 2];
-                        size_t in_dilation_stride = in_dilation[i - 2];
-
-                        in_transform_start[i] = filter_movement_stride * out_coord[i];
-                        in_transform_end[i] = in_transform_start[i] +
-                                              (filter_shape[i] - 1) * filter_dilation_stride + 1;
-                        in_transform_movement_strides[i] = filter_dilation_stride;
-                        in_transform_pad_below[i] = below_pad;
-                        in_transform_pad_above[i] = above_pad;
-                        in_transform_dilation_strides[i] = in_dilation_stride;
-                    }
-
-                    AxisVector in_transform_axis_order(2 + n_spatial_dimensions);
-                    for (size_t i = 0; i < in_transform_axis_order.size(); i++)
-                    {
-                        in_transform_axis_order[i] = i;
-                    }
-                    CoordinateTransform in_transform(in_shape,
-                                                     in_transform_start,
-                                                     in_transform_end,
-                                                     in_transform_movement_strides,
-                                                     in_transform_axis_order,
-                                                     in_transform_pad_below,
-                                                     in_transform_pad_above,
-                                                     in_transform_dilation_strides);
-
-                    // Simultaneously with iterating I, for the filter we need to iterate the
-                    // coordinate:
-                    //
-                    //   F
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (chan_out,0,0,...,0) ->
-                    //     (chan_out+1,
-                    //      chans_in_count,
-                    //      filter_dims_1,
-                    //        ...,
-                    //      filter_dims_n)
-                    //
-                    // with unit stride.
-
-                    Shape filter_transform_start(2 + n_spatial_dimensions);
-                    Shape filter_transform_end(2 + n_spatial_dimensions);
-
-                    filter_transform_start[filter_out_channel_axis] = out_channel;
-                    filter_transform_end[filter_out_channel_axis] = out_channel + 1;
-                    filter_transform_start[filter_in_channel_axis] = 0;
-                    filter_transform_end[filter_in_channel_axis] = 1;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        filter_transform_start[i] = 0;
-                        filter_transform_end[i] = filter_shape[i];
-                    }
-
-                    CoordinateTransform filter_transform(
-                        filter_shape, filter_transform_start, filter_transform_end);
-
-                    // As we go, we sum up:
-                    //
-                    //   out[O] += in[I] * filter[F].
-
-                    ACCUMULATION result = 0;
-
-                    CoordinateTransform::Iterator in_it = in_transform.begin();
-                    CoordinateTransform::Iterator filter_it = filter_transform.begin();
-                    CoordinateTransform::Iterator in_it_end = in_transform.end();
-                    CoordinateTransform::Iterator filter_it_end = filter_transform.end();
-
-                    size_t in_channel_stride = row_major_strides(in_shape).at(in_channel_axis);
-                    size_t filter_in_channel_stride =
-                        row_major_strides(filter_shape).at(filter_in_channel_axis);
-
-                    while (in_it != in_it_end && filter_it != filter_it_end)
-                    {
-                        const Coordinate& in_coord = *in_it;
-                        if (in_transform.has_source_coordinate(in_coord))
+                //
+                // For every out coordinate O = (N,chan_out,i_1,...,i_n) we sum up
+                //
+                //   out[O] += in[I] * filter[F]
+                //
+                // walking the filter coordinate F = (chan_out,chan_in,f_1,...,f_n) in the
+                // row-major order of the filter spatial axes, and the in channels innermost.
+                // The in coordinate I = (N,chan_in,s_1*i_1+l_1*f_1,...,s_n*i_n+l_n*f_n) is taken
+                // within the *padded* and *dilated* in batch, the filter positions which fall into
+                // the pad or into a dilation gap are skipped. The offsets of the filter positions
+                // are precomputed by SlidingWindow, so the summation order is the same as of the
+                // CoordinateTransform based walk.
+
+                const size_t n_spatial_dimensions = in_shape.size() - 2;
+                const size_t n_in_channels = in_shape[in_channel_axis];
+
+                const Strides in_strides = row_major_strides(in_shape);
+                const Strides filter_strides = row_major_strides(filter_shape);
+                const Strides out_strides = row_major_strides(out_shape);
+                const size_t in_channel_stride = in_strides[in_channel_axis];
+                const size_t filter_in_channel_stride = filter_strides[filter_in_channel_axis];
+
+                const SlidingWindow window(Shape(in_shape.begin() + 2, in_shape.end()),
+                                           Strides(in_strides.begin() + 2, in_strides.end()),
+                                           Shape(filter_shape.begin() + 2, filter_shape.end()),
+                                           Strides(filter_strides.begin() + 2,
+                                                   filter_strides.end()),
+                                           Shape(out_shape.begin() + 2, out_shape.end()),
+                                           stride,
+                                           filter_dilation,
+                                           in_pad_below,
+                                           in_dilation);
+
+                // Every out element is computed on its own, so they can be split between threads
+                const size_t window_size =
+                    shape_size(Shape(filter_shape.begin() + 2, filter_shape.end())) * n_in_channels;
+                parallel_for(
+                    shape_size(out_shape),
+                    (1 << 14) / std::max<size_t>(window_size, 1),
+                    [&](size_t begin, size_t end) {
+                        Coordinate out_coord(2 + n_spatial_dimensions);
+                        for (size_t out_index = begin; out_index < end; out_index++)
                         {
-                            size_t in_idx = in_transform.index(in_coord);
-                            const Coordinate& filter_coord = *filter_it;
-                            size_t filter_idx = filter_transform.index(filter_coord);
-                            for (size_t in_channel = 0; in_channel < n_in_channels; ++in_channel)
+                            for (size_t i = 0; i < out_coord.size(); i++)
                             {
-                                ACCUMULATION in_v = static_cast<ACCUMULATION>(in[in_idx]);
-                                ACCUMULATION f_v = static_cast<ACCUMULATION>(filter[filter_idx]);
-
-                                result += in_v * f_v;
-                                in_idx += in_channel_stride;
-                                filter_idx += filter_in_channel_stride;
+                                out_coord[i] = out_index / out_strides[i] % out_shape[i];
                             }
+                            const INPUT* in_batch =
+                                in + out_coord[out_batch_axis] * in_strides[in_batch_axis];
+                            const FILTER* filter_out_channel =
+                                filter + out_coord[out_channel_axis] *
+                                             filter_strides[filter_out_channel_axis];
+
+                            ACCUMULATION result = 0;
+                            window.for_each(out_coord, [&](size_t filter_idx, size_t in_idx) {
+                                for (size_t in_channel = 0; in_channel < n_in_channels;
+                                     ++in_channel)
+                                {
+                                    ACCUMULATION in_v = static_cast<ACCUMULATION>(in_batch[in_idx]);
+                                    ACCUMULATION f_v =
+                                        static_cast<ACCUMULATION>(filter_out_channel[filter_idx]);
+
+                                    result += in_v * f_v;
+                                    in_idx += in_channel_stride;
+                                    filter_idx += filter_in_channel_stride;
+                                }
+                            });
+
+                            out[out_index] = result;
                         }
-                        ++in_it;
-                        ++filter_it;
-                    }
-
-                    out[out_transform.index(out_coord)] = result;
-                }
+                    });
                 std::fesetround(old_mode);
             }
 
@@ -16,13 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <utility>
 
 #include <cfenv>
 #include <functional>
 #include "convolution.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -58,112 +60,96 @@ namespace ngraph
 
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
-                // they're right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
 
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
-                size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
-
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
-                {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
-                    {
-                        // The output coordinate is just the concatenation of the projected
-                        // coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
-
-                        // Zero out to start the sum.
-                        ACCUMULATION sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
-
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
+                // The projected axes of arg0 and arg1 and the dotted axes are contiguous in the
+                // row-major layout, so the product is computed on matrices:
+                //
+                //   out[i, j] = sum over k of arg0[i, k] * arg1[k, j]
+                //
+                // where i walks the projected axes of arg0, j the projected axes of arg1 and k the
+                // dotted axes.
+                const size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
+                const size_t rows = std::accumulate(arg0_shape.begin(),
+                                                    arg0_shape.begin() + arg0_projected_rank,
+                                                    size_t(1),
+                                                    std::multiplies<size_t>());
+                const size_t dot_size = std::accumulate(arg1_shape.begin(),
+                                                        arg1_shape.begin() + reduction_axes_count,
+                                                        size_t(1),
+                                                        std::multiplies<size_t>());
+                const size_t cols = std::accumulate(arg1_shape.begin() + reduction_axes_count,
+                                                    arg1_shape.end(),
+                                                    size_t(1),
+                                                    std::multiplies<size_t>());
+
+                // A block of sums of a row is accumulated at once to read arg1 row by row. Every
+                // sum still adds the products in the order of the dotted axes.
+                constexpr size_t block_size = 64;
+                const size_t blocks = (cols + block_size - 1) / block_size;
+                const ACCUMULATION zero_point0 =
+                    is_quantized ? static_cast<ACCUMULATION>(*input0_zero_point) : ACCUMULATION(0);
+                const ACCUMULATION zero_point1 =
+                    is_quantized ? static_cast<ACCUMULATION>(*input1_zero_point) : ACCUMULATION(0);
+                const float scale =
+                    is_quantized ? *input0_scale * *input1_scale / *output_scale : 0.0f;
+
+                parallel_for(
+                    rows * blocks,
+                    std::max<size_t>(1, (1 << 16) / std::max<size_t>(dot_size * block_size, 1)),
+                    [&](size_t begin, size_t end) {
+                        ACCUMULATION sums[block_size];
+                        for (size_t item = begin; item < end; item++)
                         {
-                            // In order to find the points to multiply together, we need to inject
-                            // our current positions along the dotted axes back into the projected
-                            // arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
-
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
+                            const size_t row = item / blocks;
+                            const size_t col_begin = item % blocks * block_size;
+                            const size_t block = std::min(block_size, cols - col_begin);
+                            std::fill(sums, sums + block, ACCUMULATION(0));
 
-                            // Multiply and add to the sum.
-                            if (is_quantized)
+                            const INPUT0* arg0_row = arg0 + row * dot_size;
+                            for (size_t k = 0; k < dot_size; k++)
                             {
-                                sum = sum + ((static_cast<ACCUMULATION>(
-                                                  arg0[arg0_transform.index(arg0_coord)]) -
-                                              static_cast<ACCUMULATION>(*input0_zero_point)) *
-                                             (static_cast<ACCUMULATION>(
-                                                  arg1[arg1_transform.index(arg1_coord)]) -
-                                              static_cast<ACCUMULATION>(*input1_zero_point)));
+                                const INPUT1* arg1_row = arg1 + k * cols + col_begin;
+                                if (is_quantized)
+                                {
+                                    const ACCUMULATION a =
+                                        static_cast<ACCUMULATION>(arg0_row[k]) - zero_point0;
+                                    for (size_t j = 0; j < block; j++)
+                                    {
+                                        sums[j] =
+                                            sums[j] +
+                                            (a * (static_cast<ACCUMULATION>(arg1_row[j]) -
+                                                  zero_point1));
+                                    }
+                                }
+                                else
+                                {
+                                    const ACCUMULATION a = static_cast<ACCUMULATION>(arg0_row[k]);
+                                    for (size_t j = 0; j < block; j++)
+                                    {
+                                        sums[j] =
+                                            sums[j] + (a * static_cast<ACCUMULATION>(arg1_row[j]));
+                                    }
+                                }
                             }
-                            else
+
+                            OUTPUT* out_row = out + row * cols + col_begin;
+                            for (size_t j = 0; j < block; j++)
                             {
-                                sum = sum + (static_cast<ACCUMULATION>(
-                                                 arg0[arg0_transform.index(arg0_coord)]) *
-                                             static_cast<ACCUMULATION>(
-                                                 arg1[arg1_transform.index(arg1_coord)]));
+                                if (is_quantized)
+                                {
+                                    // Write the sum back.
+                                    out_row[j] = static_cast<OUTPUT>(std::round(
+                                                     static_cast<float>(sums[j]) * scale)) +
+                                                 *output_zero_point;
+                                }
+                                else
+                                {
+                                    out_row[j] = sums[j];
+                                }
                             }
                         }
-
-                        if (is_quantized)
-                        {
-                            float scale = *input0_scale * *input1_scale / *output_scale;
-                            // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
-                        }
-                        else
-                        {
-                            out[out_index] = sum;
-                        }
-                    }
-                    std::fesetround(old_mode);
-                }
+                    });
+                std::fesetround(old_mode);
             }
         }
     }
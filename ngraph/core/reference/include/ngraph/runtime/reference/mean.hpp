@@ -16,12 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include <map>
 #include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -40,37 +41,17 @@ namespace ngraph
                       bool keep_dims)
             {
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                const size_t out_size = shape_size(out_shape);
+                std::vector<T> cs(out_size, 0);
+                std::fill(out, out + out_size, T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
+                for_each_reduced(in_shape, reduction_axes, [&](size_t in_index, size_t out_index) {
+                    T x = arg[in_index];
+                    T& z = out[out_index];
 
                     if (is_finite(x) && is_finite(z))
                     {
-                        T& c = cs[output_transform.index(output_coord)];
+                        T& c = cs[out_index];
                         T t = z + (x - c);
                         c = (t - z) - (x - c);
                         z = t;
@@ -79,13 +60,14 @@ namespace ngraph
                     {
                         z = z + x;
                     }
-                }
+                });
 
-                for (const Coordinate& output_coord : output_transform)
+                // Every output element is reduced from the same number of input elements
+                const int count =
+                    out_size == 0 ? 0 : static_cast<int>(shape_size(in_shape) / out_size);
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = out[i] / count;
                 }
             }
         }
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 #ifdef _WIN32
@@ -43,26 +45,16 @@ namespace ngraph
                                                                 : std::numeric_limits<T>::max();
 
                 const auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), minval);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T min = out[output_transform.index(output_coord)];
+                for_each_reduced(in_shape, reduction_axes, [&](size_t in_index, size_t out_index) {
+                    T x = arg[in_index];
+                    T min = out[out_index];
                     if (x < min)
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        out[out_index] = x;
                     }
-                }
+                });
             }
         } // namespace reference
     }     // namespace runtime
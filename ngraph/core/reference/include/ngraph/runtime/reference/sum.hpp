@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/utils/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -60,27 +63,16 @@ namespace ngraph
                      bool keep_dims)
             {
                 auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                std::vector<T> cs(shape_size(out_shape), 0);
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
+                for_each_reduced(in_shape, reduction_axes, [&](size_t in_index, size_t out_index) {
+                    T x = arg[in_index];
+                    T& z = out[out_index];
 
                     if (is_finite(x) && is_finite(z))
                     {
-                        T& c = cs[output_transform.index(output_coord)];
+                        T& c = cs[out_index];
                         T t = z + (x - c);
                         c = (t - z) - (x - c);
                         z = t;
@@ -89,7 +81,7 @@ namespace ngraph
                     {
                         z = z + x;
                     }
-                }
+                });
             }
         }
     }
@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Calls func(in_index, out_index) for every element of the input in the
+            ///        row-major order, out_index is the index of the element the input element is
+            ///        reduced to.
+            ///
+            /// The indices are advanced with precomputed strides instead of reducing coordinates,
+            /// the order of the elements is the same as of a CoordinateTransform over the input.
+            template <typename Functor>
+            void for_each_reduced(const Shape& in_shape,
+                                  const AxisSet& reduction_axes,
+                                  Functor&& func)
+            {
+                const size_t in_size = shape_size(in_shape);
+                if (in_size == 0)
+                {
+                    return;
+                }
+                if (in_shape.empty())
+                {
+                    func(0, 0);
+                    return;
+                }
+
+                // The strides of the output with the reduced axes kept, zero along the reduced axes
+                Strides out_strides = row_major_strides(reduce(in_shape, reduction_axes, true));
+                for (auto axis : reduction_axes)
+                {
+                    out_strides[axis] = 0;
+                }
+
+                const size_t rank = in_shape.size();
+                const size_t inner_size = in_shape.back();
+                const size_t inner_stride = out_strides.back();
+                Coordinate outer_coord(rank, 0);
+                size_t out_index = 0;
+                for (size_t in_index = 0; in_index < in_size; in_index += inner_size)
+                {
+                    for (size_t i = 0; i < inner_size; i++)
+                    {
+                        func(in_index + i, out_index + i * inner_stride);
+                    }
+                    // Advance the coordinate along the outer axes
+                    for (size_t axis = rank - 1; axis-- > 0;)
+                    {
+                        out_index += out_strides[axis];
+                        if (++outer_coord[axis] < in_shape[axis])
+                        {
+                            break;
+                        }
+                        out_index -= out_strides[axis] * in_shape[axis];
+                        outer_coord[axis] = 0;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/coordinate.hpp"
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Window sliding over the spatial axes of a padded and dilated input.
+            ///
+            /// The offsets of the window elements are precomputed per spatial axis, so visiting a
+            /// window costs a few additions per element instead of a CoordinateTransform. The
+            /// elements are visited in the row-major order of the window, the ones that fall into
+            /// the padding or into the dilation gaps of the input are skipped.
+            class SlidingWindow
+            {
+            public:
+                /// \param in_shape Spatial shape of the input.
+                /// \param in_strides Element strides of the spatial axes of the input.
+                /// \param window_shape Spatial shape of the window.
+                /// \param window_strides Element strides of the spatial axes of the window.
+                /// \param out_shape Spatial shape of the output.
+                /// \param movement_strides Strides of the window movement.
+                /// \param window_dilation Dilation of the window.
+                /// \param pad_below Padding added before the input.
+                /// \param in_dilation Dilation of the input.
+                SlidingWindow(const Shape& in_shape,
+                              const Strides& in_strides,
+                              const Shape& window_shape,
+                              const Strides& window_strides,
+                              const Shape& out_shape,
+                              const Strides& movement_strides,
+                              const Strides& window_dilation,
+                              const CoordinateDiff& pad_below,
+                              const Strides& in_dilation)
+                    : m_elements(in_shape.size())
+                {
+                    for (size_t axis = 0; axis < in_shape.size(); axis++)
+                    {
+                        const std::ptrdiff_t in_dilated_size =
+                            in_shape[axis] == 0
+                                ? 0
+                                : static_cast<std::ptrdiff_t>((in_shape[axis] - 1) *
+                                                              in_dilation[axis]) +
+                                      1;
+                        m_elements[axis].resize(out_shape[axis]);
+                        for (size_t out = 0; out < out_shape[axis]; out++)
+                        {
+                            for (size_t i = 0; i < window_shape[axis]; i++)
+                            {
+                                const std::ptrdiff_t pos = static_cast<std::ptrdiff_t>(
+                                    out * movement_strides[axis] + i * window_dilation[axis]);
+                                const std::ptrdiff_t in_pos = pos - pad_below[axis];
+                                if (in_pos < 0 || in_pos >= in_dilated_size ||
+                                    in_pos % in_dilation[axis] != 0)
+                                {
+                                    continue;
+                                }
+                                m_elements[axis][out].push_back(
+                                    {i * window_strides[axis],
+                                     in_pos / in_dilation[axis] * in_strides[axis]});
+                            }
+                        }
+                    }
+                }
+
+                /// \brief Calls func(window_offset, in_offset) for the window elements at the
+                ///        output position which fall into the input.
+                ///
+                /// \param out_coord Coordinate of the output, its spatial axes start from the
+                ///                  axis 2 (N, C, spatial axes...).
+                template <typename Functor>
+                void for_each(const Coordinate& out_coord, Functor&& func) const
+                {
+                    visit(0, out_coord, 0, 0, func);
+                }
+
+            private:
+                struct Element
+                {
+                    size_t window_offset;
+                    size_t in_offset;
+                };
+
+                template <typename Functor>
+                void visit(size_t axis,
+                           const Coordinate& out_coord,
+                           size_t window_offset,
+                           size_t in_offset,
+                           Functor& func) const
+                {
+                    if (axis == m_elements.size())
+                    {
+                        func(window_offset, in_offset);
+                        return;
+                    }
+                    for (const auto& element : m_elements[axis][out_coord[axis + 2]])
+                    {
+                        visit(axis + 1,
+                              out_coord,
+                              window_offset + element.window_offset,
+                              in_offset + element.in_offset,
+                              func);
+                    }
+                }
+
+                // The elements of the window for every output position along every spatial axis
+                std::vector<std::vector<std::vector<Element>>> m_elements;
+            };
+        }
+    }
+}
@@ -14,8 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cmath>
-#include <stdio.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
@@ -24,228 +28,132 @@ using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        memcpy(out, in, elem_size);
-    }
+    // Square tiles of this size are transposed at once, so the lines of the input read by a tile
+    // stay in cache until all their elements are copied
+    constexpr size_t transpose_tile = 16;
 
-    void reshape_in1(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // Calls f(in_offset, out_offset) for every position of the given axes, offsets are updated
+    // incrementally instead of computing them from coordinates
+    template <typename F>
+    void for_each_position(const std::vector<size_t>& axes,
+                           const std::vector<size_t>& dims,
+                           const std::vector<size_t>& in_strides,
+                           const std::vector<size_t>& out_strides,
+                           F f)
     {
-        size_t size[1];
-        size_t in_index[1];
-        size_t* map_index[1];
-        for (size_t i = 0; i < 1; i++)
+        std::vector<size_t> coord(axes.size(), 0);
+        size_t in_offset = 0;
+        size_t out_offset = 0;
+        while (true)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            memcpy(out, in + *map_index[0] * elem_size, elem_size);
-            out += elem_size;
-        }
-    }
-
-    void reshape_in2(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[2];
-        size_t in_index[2];
-        size_t* map_index[2];
-        for (size_t i = 0; i < 2; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-                // clang-format on
-            }
-        }
-    }
+            f(in_offset, out_offset);
 
-    void reshape_in3(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[3];
-        size_t in_index[3];
-        size_t* map_index[3];
-        for (size_t i = 0; i < 3; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            size_t i = axes.size();
+            for (; i > 0; --i)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                const size_t axis = axes[i - 1];
+                in_offset += in_strides[axis];
+                out_offset += out_strides[axis];
+                if (++coord[i - 1] < dims[axis])
                 {
-                    // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                    // clang-format on
+                    break;
                 }
+                in_offset -= in_strides[axis] * dims[axis];
+                out_offset -= out_strides[axis] * dims[axis];
+                coord[i - 1] = 0;
+            }
+            if (i == 0)
+            {
+                return;
             }
         }
     }
 
-    void reshape_in4(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // out[r * out_row_stride + c] = in[r + c * in_col_stride]
+    template <typename T>
+    void transpose_plane(const T* in,
+                         T* out,
+                         size_t rows,
+                         size_t cols,
+                         size_t in_col_stride,
+                         size_t out_row_stride)
     {
-        size_t size[4];
-        size_t in_index[4];
-        size_t* map_index[4];
-        for (size_t i = 0; i < 4; i++)
+        for (size_t r0 = 0; r0 < rows; r0 += transpose_tile)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            const size_t r1 = std::min(rows, r0 + transpose_tile);
+            for (size_t c0 = 0; c0 < cols; c0 += transpose_tile)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                const size_t c1 = std::min(cols, c0 + transpose_tile);
+                for (size_t r = r0; r < r1; ++r)
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                    const T* src = in + r;
+                    T* dst = out + r * out_row_stride;
+                    for (size_t c = c0; c < c1; ++c)
                     {
-                        // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                        // clang-format on
+                        dst[c] = src[c * in_col_stride];
                     }
                 }
             }
         }
     }
 
-    void reshape_in5(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // dims are the output dims and in_strides are the strides of the input for them
+    template <typename T>
+    void reshape_typed(const T* in,
+                       T* out,
+                       const std::vector<size_t>& dims,
+                       const std::vector<size_t>& in_strides)
     {
-        size_t size[5];
-        size_t in_index[5];
-        size_t* map_index[5];
-        for (size_t i = 0; i < 5; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        const size_t rank = dims.size();
+        std::vector<size_t> out_strides(rank, 1);
+        for (size_t i = rank - 1; i > 0; --i)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                            // clang-format on
-                        }
-                    }
-                }
-            }
+            out_strides[i - 1] = out_strides[i] * dims[i];
         }
-    }
 
-    void reshape_in6(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[6];
-        size_t in_index[6];
-        size_t* map_index[6];
-        for (size_t i = 0; i < 6; i++)
+        if (in_strides.back() == 1)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
+            // the innermost output dim is contiguous in the input
+            const size_t run = dims.back();
+            std::vector<size_t> outer_axes(rank - 1);
+            std::iota(outer_axes.begin(), outer_axes.end(), 0);
+            for_each_position(outer_axes,
+                              dims,
+                              in_strides,
+                              out_strides,
+                              [&](size_t in_offset, size_t out_offset) {
+                                  std::copy(in + in_offset, in + in_offset + run, out + out_offset);
+                              });
+            return;
         }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+
+        // the dim which is contiguous in the input is transposed with the innermost output dim
+        const size_t contiguous_axis =
+            std::find(in_strides.begin(), in_strides.end(), 1) - in_strides.begin();
+        NGRAPH_CHECK(contiguous_axis < rank, "Internal error: no contiguous dim in reshape");
+        std::vector<size_t> outer_axes;
+        for (size_t i = 0; i + 1 < rank; ++i)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            if (i != contiguous_axis)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                            {
-                                // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                                // clang-format on
-                            }
-                        }
-                    }
-                }
+                outer_axes.push_back(i);
             }
         }
+        for_each_position(outer_axes,
+                          dims,
+                          in_strides,
+                          out_strides,
+                          [&](size_t in_offset, size_t out_offset) {
+                              transpose_plane(in + in_offset,
+                                              out + out_offset,
+                                              dims[contiguous_axis],
+                                              dims.back(),
+                                              in_strides.back(),
+                                              out_strides[contiguous_axis]);
+                          });
     }
 }
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -253,15 +161,87 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    NGRAPH_CHECK(in_axis_order.size() == in_shape.size(),
+                 "Reshape axis order size doesn't match input shape rank");
+    const size_t rank = in_shape.size();
+    std::vector<size_t> in_strides(rank, 1);
+    for (size_t i = rank; i > 1; --i)
+    {
+        in_strides[i - 2] = in_strides[i - 1] * in_shape[i - 1];
+    }
+
+    // Output dims with their input strides. Unit dims are dropped and consecutive output dims
+    // which are also consecutive in the input are merged, e.g. transposes which keep the order
+    // of the non-unit dims become a single copy.
+    std::vector<size_t> dims;
+    std::vector<size_t> strides;
+    for (size_t i = 0; i < rank; ++i)
+    {
+        const size_t dim = in_shape[in_axis_order[i]];
+        const size_t stride = in_strides[in_axis_order[i]];
+        if (dim == 0)
+        {
+            return;
+        }
+        if (dim == 1)
+        {
+            continue;
+        }
+        if (!dims.empty() && strides.back() == stride * dim)
+        {
+            dims.back() *= dim;
+            strides.back() = stride;
+        }
+        else
+        {
+            dims.push_back(dim);
+            strides.push_back(stride);
+        }
+    }
+    if (dims.empty())
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+        memcpy(out, in, elem_size);
+        return;
+    }
+
+    switch (elem_size)
+    {
+    case 1:
+        reshape_typed(reinterpret_cast<const uint8_t*>(in),
+                      reinterpret_cast<uint8_t*>(out),
+                      dims,
+                      strides);
+        break;
+    case 2:
+        reshape_typed(reinterpret_cast<const uint16_t*>(in),
+                      reinterpret_cast<uint16_t*>(out),
+                      dims,
+                      strides);
+        break;
+    case 4:
+        reshape_typed(reinterpret_cast<const uint32_t*>(in),
+                      reinterpret_cast<uint32_t*>(out),
+                      dims,
+                      strides);
+        break;
+    case 8:
+        reshape_typed(reinterpret_cast<const uint64_t*>(in),
+                      reinterpret_cast<uint64_t*>(out),
+                      dims,
+                      strides);
+        break;
+    default:
+        // bytes of an element are the innermost dim
+        for (auto& stride : strides)
+        {
+            stride *= elem_size;
+        }
+        dims.push_back(elem_size);
+        strides.push_back(1);
+        reshape_typed(reinterpret_cast<const uint8_t*>(in),
+                      reinterpret_cast<uint8_t*>(out),
+                      dims,
+                      strides);
+        break;
     }
 }
@@ -123,6 +123,27 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    if (*m_ordered_ops_valid)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (const auto& node : m_ordered_ops)
+        {
+            auto ordered_op = node.lock();
+            if (!ordered_op)
+            {
+                break;
+            }
+            ordered_ops.push_back(move(ordered_op));
+        }
+        // nodes of an unchanged graph are alive as they are reachable from the results
+        if (ordered_ops.size() == m_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -137,7 +158,18 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    Node::add_topology_cache(ordered_ops, m_ordered_ops_valid);
+    m_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    *m_ordered_ops_valid = true;
+    return ordered_ops;
+}
+
+void Function::invalidate_ordered_ops() const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_ordered_ops.clear();
+    *m_ordered_ops_valid = false;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -301,11 +333,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -375,12 +409,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_ordered_ops();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -389,11 +425,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -403,6 +441,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_ordered_ops();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
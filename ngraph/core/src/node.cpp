@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -33,6 +35,12 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+namespace
+{
+    // Guards the topology caches of all nodes, as the nodes may be shared by several functions
+    mutex s_topology_caches_mutex;
+}
+
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
@@ -72,6 +80,7 @@ Node& Node::operator=(const Node& node)
         input = descriptor::Input(this, input.get_index(), input.get_output());
         input.get_output().add_input(&input);
     }
+    invalidate_topology_caches();
     return *this;
 }
 
@@ -481,6 +490,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        invalidate_topology_caches();
     }
 }
 
@@ -513,6 +523,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            invalidate_topology_caches();
         }
     }
     {
@@ -535,6 +546,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    invalidate_topology_caches();
 }
 
 void Node::clear_control_dependents()
@@ -545,6 +557,38 @@ void Node::clear_control_dependents()
     }
 }
 
+void Node::add_topology_cache(const std::vector<std::shared_ptr<Node>>& nodes,
+                              const std::shared_ptr<std::atomic<bool>>& valid)
+{
+    lock_guard<mutex> lock(s_topology_caches_mutex);
+    for (const auto& node : nodes)
+    {
+        auto& caches = node->m_topology_caches;
+        caches.erase(remove_if(caches.begin(),
+                               caches.end(),
+                               [](const weak_ptr<atomic<bool>>& cache) { return cache.expired(); }),
+                     caches.end());
+        if (none_of(caches.begin(), caches.end(), [&valid](const weak_ptr<atomic<bool>>& cache) {
+                return cache.lock() == valid;
+            }))
+        {
+            caches.push_back(valid);
+        }
+    }
+}
+
+void Node::invalidate_topology_caches()
+{
+    lock_guard<mutex> lock(s_topology_caches_mutex);
+    for (const auto& cache : m_topology_caches)
+    {
+        if (auto valid = cache.lock())
+        {
+            *valid = false;
+        }
+    }
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
@@ -15,53 +15,183 @@
 //*****************************************************************************
 
 #include "constant_folding.hpp"
+#include <algorithm>
+#include <exception>
 #include <ngraph/rt_info.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/runtime/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Nodes are folded in parallel only if their constant inputs have at least this number of
+    // elements in total, small subgraphs are not worth starting threads
+    constexpr size_t parallel_folding_min_elements = 1 << 16;
+
+    // The node is folded by the default way and all its inputs are folded already
+    bool is_ready_for_folding(const Node* node)
+    {
+        if (node->get_input_size() == 0 || dynamic_cast<const op::util::SubGraphOp*>(node))
+        {
+            return false;
+        }
+        for (const auto& input : node->inputs())
+        {
+            if (!is_type<op::Constant>(input.get_source_output().get_node()))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t input_elements_count(const Node* node)
+    {
+        size_t count = 0;
+        for (const auto& input : node->inputs())
+        {
+            count += shape_size(input.get_shape());
+        }
+        return count;
+    }
+
+    // Runs constant_fold of the nodes, concurrently if it is worth it
+    void fold_nodes(const std::vector<std::shared_ptr<Node>>& nodes,
+                    bool concurrently,
+                    std::vector<OutputVector>& replacements,
+                    std::vector<char>& folded)
+    {
+        replacements.assign(nodes.size(), OutputVector{});
+        folded.assign(nodes.size(), false);
+        std::vector<std::exception_ptr> errors(nodes.size());
+        auto fold = [&](size_t i) {
+            try
+            {
+                const auto& node = nodes[i];
+                node->revalidate_and_infer_types();
+                replacements[i].resize(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        // Kernels called by constant_fold run sequentially inside a parallel region
+        runtime::parallel_for(
+            nodes.size(), concurrently ? 1 : nodes.size(), [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    fold(i);
+                }
+            });
+
+        for (const auto& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
 
-    for (const auto& node : f->get_ordered_ops())
+    // Nodes which inputs are all constants do not depend on each other, so they are folded
+    // concurrently wave by wave: folding of a wave may make the consumers of its nodes ready for
+    // the next one, so only these consumers are checked instead of the whole graph. Replacements
+    // are applied in the topological order, so the result does not depend on the threads.
+    const auto ordered_ops = f->get_ordered_ops();
+    std::unordered_map<const Node*, size_t> positions;
+    std::vector<std::shared_ptr<Node>> wave;
+    for (const auto& node : ordered_ops)
     {
-        node->revalidate_and_infer_types();
+        positions.emplace(node.get(), positions.size());
+        if (is_ready_for_folding(node.get()))
+        {
+            wave.push_back(node);
+        }
+    }
+    std::unordered_set<const Node*> queued;
+    for (const auto& node : wave)
+    {
+        queued.insert(node.get());
+    }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+    std::unordered_set<std::shared_ptr<Node>> not_folded;
+    while (!wave.empty())
+    {
+        size_t wave_elements = 0;
+        for (const auto& node : wave)
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            wave_elements += input_elements_count(node.get());
+        }
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+        std::vector<OutputVector> replacements;
+        std::vector<char> folded;
+        fold_nodes(wave, wave_elements >= parallel_folding_min_elements, replacements, folded);
+        std::vector<std::shared_ptr<Node>> next_wave;
+        for (size_t i = 0; i < wave.size(); i++)
+        {
+            if (!folded[i])
+            {
+                not_folded.insert(wave[i]);
+                continue;
+            }
+            rewritten |= replace_outputs(wave[i], replacements[i]);
+            for (const auto& replacement : replacements[i])
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                if (!replacement.get_node_shared_ptr())
                 {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
+                    continue;
+                }
+                for (const auto& input : replacement.get_target_inputs())
+                {
+                    auto consumer = input.get_node();
+                    // new nodes are left to the sequential folding below
+                    if (positions.count(consumer) && !queued.count(consumer) &&
+                        is_ready_for_folding(consumer))
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
+                        queued.insert(consumer);
+                        next_wave.push_back(consumer->shared_from_this());
                     }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
                 }
             }
         }
+        std::sort(next_wave.begin(),
+                  next_wave.end(),
+                  [&positions](const std::shared_ptr<Node>& lhs, const std::shared_ptr<Node>& rhs) {
+                      return positions.at(lhs.get()) < positions.at(rhs.get());
+                  });
+        wave = std::move(next_wave);
+    }
+
+    // The rest of nodes may still be folded by their own means, e.g. ShapeOf of a static shape
+    for (const auto& node : f->get_ordered_ops())
+    {
+        if (not_folded.count(node))
+        {
+            continue;
+        }
+
+        node->revalidate_and_infer_types();
+
+        OutputVector replacements(node->get_output_size());
+        if (node->constant_fold(replacements, node->input_values()))
+        {
+            rewritten |= replace_outputs(node, replacements);
+        }
         else
         {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
@@ -78,6 +208,39 @@ bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Func
     return rewritten;
 }
 
+bool ngraph::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements)
+{
+    NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                 "constant_fold_default returned incorrect number of replacements for ",
+                 node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i)
+    {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement))
+        {
+            if (replacements.size() == 1)
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(node->get_friendly_name());
+            }
+            else
+            {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    node->get_friendly_name() + "." + std::to_string(i));
+            }
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ngraph::pass::ConstantFolding::copy_runtime_info_to_target_inputs(
     const std::shared_ptr<Node>& node, const Output<Node>& replacement)
 {
@@ -0,0 +1,228 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    // Set in the worker threads to run nested parallel_for calls sequentially
+    thread_local bool in_parallel_region = false;
+
+    // Set by ParallelThreadsLimit, 0 means the number of hardware threads
+    thread_local size_t threads_limit = 0;
+
+    // Chunks of one parallel_for call, processed by the calling thread and the pool workers
+    class ParallelJob
+    {
+    public:
+        ParallelJob(size_t work_amount,
+                    size_t chunk,
+                    const std::function<void(size_t begin, size_t end)>& func)
+            : m_work_amount(work_amount)
+            , m_chunk(chunk)
+            , m_func(func)
+        {
+        }
+
+        // Called by a pool worker, does nothing once the calling thread stopped waiting
+        void help()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_closed)
+                {
+                    return;
+                }
+                m_active++;
+            }
+            run();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_active == 0)
+            {
+                m_finished.notify_all();
+            }
+        }
+
+        // Called by the calling thread, returns when all the chunks are processed
+        void run_and_wait()
+        {
+            run();
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_closed = true;
+            m_finished.wait(lock, [this] { return m_active == 0; });
+            if (m_error)
+            {
+                std::rethrow_exception(m_error);
+            }
+        }
+
+    private:
+        void run()
+        {
+            for (size_t begin = m_next.fetch_add(m_chunk); begin < m_work_amount;
+                 begin = m_next.fetch_add(m_chunk))
+            {
+                try
+                {
+                    m_func(begin, std::min(begin + m_chunk, m_work_amount));
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_error)
+                    {
+                        m_error = std::current_exception();
+                    }
+                    m_next = m_work_amount;
+                }
+            }
+        }
+
+        const size_t m_work_amount;
+        const size_t m_chunk;
+        const std::function<void(size_t begin, size_t end)>& m_func;
+        std::atomic<size_t> m_next{0};
+        std::mutex m_mutex;
+        std::condition_variable m_finished;
+        size_t m_active = 0;
+        bool m_closed = false;
+        std::exception_ptr m_error;
+    };
+
+    // Threads are started on first use and kept for the following calls, kernels call
+    // parallel_for on every inference, so starting threads per call would dominate small ones
+    class WorkerPool
+    {
+    public:
+        // Never destroyed: joining threads while static objects are destroyed, e.g. when
+        // the library is unloaded on Windows, may deadlock. Idle workers only wait.
+        static WorkerPool& get()
+        {
+            static WorkerPool* pool = new WorkerPool();
+            return *pool;
+        }
+
+        // Asks helpers_num workers to help with the job
+        void submit(const std::shared_ptr<ParallelJob>& job, size_t helpers_num)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                while (m_workers.size() < helpers_num)
+                {
+                    m_workers.emplace_back(&WorkerPool::work, this);
+                }
+                m_queue.insert(m_queue.end(), helpers_num, job);
+            }
+            if (helpers_num == 1)
+            {
+                m_has_jobs.notify_one();
+            }
+            else
+            {
+                m_has_jobs.notify_all();
+            }
+        }
+
+    private:
+        void work()
+        {
+            in_parallel_region = true;
+            while (true)
+            {
+                std::shared_ptr<ParallelJob> job;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_has_jobs.wait(lock, [this] { return !m_queue.empty(); });
+                    job = std::move(m_queue.front());
+                    m_queue.pop_front();
+                }
+                job->help();
+            }
+        }
+
+        std::mutex m_mutex;
+        std::condition_variable m_has_jobs;
+        std::deque<std::shared_ptr<ParallelJob>> m_queue;
+        std::vector<std::thread> m_workers;
+    };
+}
+
+size_t runtime::get_parallel_threads_limit()
+{
+    return threads_limit != 0 ? threads_limit
+                              : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+runtime::ParallelThreadsLimit::ParallelThreadsLimit(size_t limit)
+    : m_previous_limit(threads_limit)
+{
+    threads_limit = limit;
+}
+
+runtime::ParallelThreadsLimit::~ParallelThreadsLimit()
+{
+    threads_limit = m_previous_limit;
+}
+
+void runtime::parallel_for(size_t work_amount,
+                           size_t min_chunk,
+                           const std::function<void(size_t begin, size_t end)>& func)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+    min_chunk = std::max<size_t>(min_chunk, 1);
+    const size_t threads_num =
+        in_parallel_region
+            ? 1
+            : std::min<size_t>(get_parallel_threads_limit(), work_amount / min_chunk);
+    if (threads_num <= 1)
+    {
+        func(0, work_amount);
+        return;
+    }
+
+    // A few chunks per thread balance the load if items take different time
+    const size_t chunks_num = 4 * threads_num;
+    const size_t chunk = std::max(min_chunk, (work_amount + chunks_num - 1) / chunks_num);
+    auto job = std::make_shared<ParallelJob>(work_amount, chunk, func);
+    WorkerPool::get().submit(job, threads_num - 1);
+
+    in_parallel_region = true;
+    try
+    {
+        job->run_and_wait();
+    }
+    catch (...)
+    {
+        in_parallel_region = false;
+        throw;
+    }
+    in_parallel_region = false;
+}
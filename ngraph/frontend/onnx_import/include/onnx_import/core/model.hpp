@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -41,6 +42,9 @@ namespace ngraph
         public:
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \brief Constructs a model which shares the ownership of the protobuf message, the
+            ///        initializers of its graph are imported without copying their raw data.
+            explicit Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto);
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -52,6 +56,12 @@ namespace ngraph
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
             const OpsetImports& get_opset_imports() const;
+            /// \brief Returns the owner of the protobuf message or nullptr if the model does not
+            ///        share its ownership.
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_model_proto_owner() const
+            {
+                return m_model_proto_owner;
+            }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -84,6 +94,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto_owner;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
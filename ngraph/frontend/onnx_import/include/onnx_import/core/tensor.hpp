@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "tensor_external_data.hpp"
@@ -483,8 +486,13 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor       The tensor protobuf message.
+            /// \param model_proto  The owner of the message, if it is given the Constant created
+            ///                     from the tensor references the raw data of the message.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -606,8 +614,11 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant(type);
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -615,7 +626,46 @@ namespace ngraph
                 return constant;
             }
 
+            /// Creates a Constant over the external data file mapped into memory or over the raw
+            /// data of the message kept alive by its owner. Returns nullptr if the data cannot be
+            /// shared, e.g. its size does not match the shape or it is not aligned to the type.
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+                const auto is_shareable = [&](const void* data, size_t size) {
+                    return size != 0 && size == shape_size(m_shape) * type.size() &&
+                           reinterpret_cast<std::uintptr_t>(data) % type.size() == 0;
+                };
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    auto buffer =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+                    if (buffer && is_shareable(buffer->get_ptr(), buffer->size()))
+                    {
+                        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                else if (m_model_proto && m_tensor_proto->has_raw_data())
+                {
+                    const auto& raw_data = m_tensor_proto->raw_data();
+                    if (is_shareable(raw_data.data(), raw_data.size()))
+                    {
+                        auto owner = m_model_proto;
+                        auto buffer = std::make_shared<runtime::SharedBuffer<
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>>(
+                            const_cast<char*>(raw_data.data()), raw_data.size(), owner);
+                        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                return nullptr;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
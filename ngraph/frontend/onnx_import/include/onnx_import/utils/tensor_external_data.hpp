@@ -16,14 +16,37 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
     {
         namespace detail
         {
+            struct MappedFiles;
+
+            /// \brief  Shares the mappings of external data files between the tensors created in
+            ///         the current thread while the object exists, i.e. during one model import.
+            ///         Separate imports never share a mapping, so a Constant modified in place
+            ///         does not change the models imported from the same file.
+            class ExternalDataMappingScope
+            {
+            public:
+                ExternalDataMappingScope();
+                ~ExternalDataMappingScope();
+
+                ExternalDataMappingScope(const ExternalDataMappingScope&) = delete;
+                ExternalDataMappingScope& operator=(const ExternalDataMappingScope&) = delete;
+
+            private:
+                std::unique_ptr<MappedFiles> m_mapped_files;
+                MappedFiles* m_previous_mapped_files = nullptr;
+            };
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -39,12 +62,28 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       A file is mapped once for all tensors of an import stored in it,
+                ///             see ExternalDataMappingScope. If the file cannot be mapped, the
+                ///             data is read into a buffer instead. If the file cannot be opened,
+                ///             the invalid_external_data exception is thrown.
+                ///
+                /// \return     Buffer referencing the data, the file stays mapped as long as any
+                ///             buffer referencing it is alive. nullptr if the data lies outside
+                ///             the file.
+                std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<void>>>
+                    load_external_mmap_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
                 std::string to_string() const;
 
             private:
+                std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<void>>>
+                    read_external_data() const;
+
                 std::string m_data_location;
                 int m_offset = 0;
                 int m_data_lenght = 0;
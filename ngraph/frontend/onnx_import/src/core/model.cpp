@@ -63,6 +63,12 @@ namespace ngraph
             }
         }
 
+        Model::Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
+            : Model(*model_proto)
+        {
+            m_model_proto_owner = std::move(model_proto);
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
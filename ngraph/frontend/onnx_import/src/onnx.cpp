@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
 #include <memory>
@@ -25,6 +26,7 @@
 #include "onnx_import/core/transform.hpp"
 #include "onnx_import/onnx.hpp"
 #include "onnx_import/ops_bridge.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -74,11 +76,24 @@ namespace ngraph
 
             } // namespace error
 
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            /// Creates the message on an arena which lives as long as the message is referenced.
+            /// The model is parsed with a few large allocations and the Constants created from
+            /// its initializers keep the arena alive instead of copying the raw data out of it.
+            std::shared_ptr<ONNX_NAMESPACE::ModelProto> make_model_proto()
+            {
+                const auto arena = std::make_shared<google::protobuf::Arena>();
+                const auto model_proto =
+                    google::protobuf::Arena::Create<ONNX_NAMESPACE::ModelProto>(arena.get());
+                return std::shared_ptr<ONNX_NAMESPACE::ModelProto>(arena, model_proto);
+            }
+
+            std::shared_ptr<Function> convert_to_ng_function(
+                std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
             {
                 Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                // tensors of the model stored in one external data file share its mapping
+                ExternalDataMappingScope mapping_scope;
+                Graph graph{model_proto->graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -103,7 +118,8 @@ namespace ngraph
                 }
             }
 
-            ONNX_NAMESPACE::ModelProto model_proto;
+            const auto model_proto_owner = detail::make_model_proto();
+            auto& model_proto = *model_proto_owner;
             // Try parsing input as a binary protobuf message
             if (!model_proto.ParseFromIstream(&stream))
             {
@@ -126,7 +142,7 @@ namespace ngraph
             transform::fixup_legacy_operators(model_proto);
             transform::update_external_data_paths(model_proto, model_path);
 
-            return detail::convert_to_ng_function(model_proto);
+            return detail::convert_to_ng_function(model_proto_owner);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -16,6 +16,13 @@
 
 #include <fstream>
 #include <sstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -28,6 +35,98 @@ namespace ngraph
     {
         namespace detail
         {
+#ifndef _WIN32
+            namespace
+            {
+                /// \brief Private mapping of a whole external data file. The tensors stored in
+                ///        the file reference it at their offsets, so it is mapped only once.
+                struct MappedFile
+                {
+                    ~MappedFile() { munmap(m_address, m_size); }
+
+                    void* m_address = nullptr;
+                    size_t m_size = 0;
+                    dev_t m_device = 0;
+                    ino_t m_inode = 0;
+                    time_t m_modification_time = 0;
+                };
+            }
+
+            struct MappedFiles
+            {
+                std::map<std::string, std::shared_ptr<MappedFile>> m_files;
+            };
+#else
+            struct MappedFiles
+            {
+            };
+#endif
+
+            namespace
+            {
+                // Set by ExternalDataMappingScope of the import running in the current thread
+                thread_local MappedFiles* current_mapped_files = nullptr;
+            }
+
+#ifndef _WIN32
+            namespace
+            {
+                /// \brief Returns the mapping of the file, which is shared with other tensors
+                ///        of the current import. nullptr if the file cannot be mapped.
+                std::shared_ptr<MappedFile> map_file(const std::string& path,
+                                                     int fd,
+                                                     const struct stat& file_stat)
+                {
+                    std::shared_ptr<MappedFile> mapping;
+                    if (current_mapped_files)
+                    {
+                        mapping = current_mapped_files->m_files[path];
+                    }
+                    // a file replaced or changed since it was mapped is mapped again
+                    if (mapping && mapping->m_device == file_stat.st_dev &&
+                        mapping->m_inode == file_stat.st_ino &&
+                        mapping->m_size == static_cast<size_t>(file_stat.st_size) &&
+                        mapping->m_modification_time == file_stat.st_mtime)
+                    {
+                        return mapping;
+                    }
+
+                    // private mapping lets the data of a Constant be modified without touching
+                    // the file, other imports of the file have mappings of their own
+                    const auto size = static_cast<size_t>(file_stat.st_size);
+                    void* address =
+                        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+                    if (address == MAP_FAILED)
+                    {
+                        return nullptr;
+                    }
+                    mapping = std::make_shared<MappedFile>();
+                    mapping->m_address = address;
+                    mapping->m_size = size;
+                    mapping->m_device = file_stat.st_dev;
+                    mapping->m_inode = file_stat.st_ino;
+                    mapping->m_modification_time = file_stat.st_mtime;
+                    if (current_mapped_files)
+                    {
+                        current_mapped_files->m_files[path] = mapping;
+                    }
+                    return mapping;
+                }
+            }
+#endif
+
+            ExternalDataMappingScope::ExternalDataMappingScope()
+                : m_mapped_files(new MappedFiles)
+                , m_previous_mapped_files(current_mapped_files)
+            {
+                current_mapped_files = m_mapped_files.get();
+            }
+
+            ExternalDataMappingScope::~ExternalDataMappingScope()
+            {
+                current_mapped_files = m_previous_mapped_files;
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -61,13 +160,6 @@ namespace ngraph
                 else
                     read_data_lenght = m_data_lenght;
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
                 external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -84,6 +176,63 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<void>>>
+                TensorExternalData::load_external_mmap_data() const
+            {
+#ifdef _WIN32
+                // without a mapping the data is read once and the buffer owns the string
+                return read_external_data();
+#else
+                const int fd = open(m_data_location.c_str(), O_RDONLY);
+                if (fd == -1)
+                    throw error::invalid_external_data{*this};
+
+                struct stat file_stat;
+                if (fstat(fd, &file_stat) == -1)
+                {
+                    close(fd);
+                    throw error::invalid_external_data{*this};
+                }
+                // default value of m_data_lenght is 0, i.e. read the file up to its end
+                const auto file_size = static_cast<size_t>(file_stat.st_size);
+                const auto offset = static_cast<size_t>(m_offset);
+                const auto length =
+                    m_data_lenght == 0 ? file_size - offset : static_cast<size_t>(m_data_lenght);
+                if (m_offset < 0 || m_data_lenght < 0 || offset >= file_size ||
+                    length > file_size - offset)
+                {
+                    // pages beyond the end of the file cannot be accessed,
+                    // load_external_data() handles such data instead
+                    close(fd);
+                    return nullptr;
+                }
+
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                const auto mapping = map_file(m_data_location, fd, file_stat);
+                close(fd);
+                if (!mapping)
+                {
+                    return read_external_data();
+                }
+                std::shared_ptr<void> owner = mapping;
+                return std::make_shared<runtime::SharedBuffer<std::shared_ptr<void>>>(
+                    static_cast<char*>(mapping->m_address) + offset, length, owner);
+#endif
+            }
+
+            std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<void>>>
+                TensorExternalData::read_external_data() const
+            {
+                auto data = std::make_shared<std::string>(load_external_data());
+                std::shared_ptr<void> owner = data;
+                return std::make_shared<runtime::SharedBuffer<std::shared_ptr<void>>>(
+                    &(*data)[0], data->size(), owner);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+#include <numeric>
+
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
@@ -2045,6 +2048,151 @@ TEST(constant_folding, constant_transpose)
     ASSERT_TRUE(test::all_close_f(values_permute, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, constant_transpose_permutations)
+{
+    const vector<pair<Shape, vector<int64_t>>> cases{{{3, 1, 5, 2}, {2, 0, 3, 1}},
+                                                     {{4, 3, 2}, {0, 2, 1}},
+                                                     {{2, 3, 17, 19}, {0, 1, 3, 2}},
+                                                     {{2, 3, 2, 1, 2, 3, 2}, {6, 1, 4, 0, 3, 5, 2}},
+                                                     {{5, 0, 3}, {2, 1, 0}}};
+    for (const auto& c : cases)
+    {
+        const Shape& shape_in = c.first;
+        const auto& order = c.second;
+        vector<int32_t> values_in(shape_size(shape_in));
+        iota(values_in.begin(), values_in.end(), 0);
+
+        auto constant_in = make_shared<op::Constant>(element::i32, shape_in, values_in);
+        auto constant_perm = op::Constant::create(element::i64, Shape{order.size()}, order);
+        auto transpose = make_shared<op::Transpose>(constant_in, constant_perm);
+        auto f = make_shared<Function>(transpose, ParameterVector{});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
+        pass_manager.run_passes(f);
+
+        ASSERT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+        auto new_const =
+            as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+
+        Shape shape_out(order.size());
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            shape_out[i] = shape_in[order[i]];
+        }
+        ASSERT_EQ(shape_out, new_const->get_output_shape(0));
+        const auto strides_in = row_major_strides(shape_in);
+        const auto strides_out = row_major_strides(shape_out);
+        const auto values_out = new_const->get_vector<int32_t>();
+        for (size_t out_offset = 0; out_offset < values_out.size(); out_offset++)
+        {
+            size_t in_offset = 0;
+            for (size_t i = 0; i < order.size(); i++)
+            {
+                in_offset += out_offset / strides_out[i] % shape_out[i] * strides_in[order[i]];
+            }
+            ASSERT_EQ(values_in[in_offset], values_out[out_offset]);
+        }
+    }
+}
+
+static shared_ptr<Function> make_transposed_weights_function(size_t layers, size_t hidden)
+{
+    // Attention weights of a BERT-like model stored transposed and scaled, as they come from
+    // frameworks
+    NodeVector outputs;
+    for (size_t layer = 0; layer < layers; layer++)
+    {
+        for (size_t i = 0; i < 4; i++)
+        {
+            vector<float> values(hidden * hidden);
+            iota(values.begin(), values.end(), static_cast<float>(layer * 4 + i));
+            auto weights = make_shared<op::Constant>(element::f32, Shape{hidden, hidden}, values);
+            auto perm = op::Constant::create(element::i64, Shape{2}, {1, 0});
+            auto transpose = make_shared<op::Transpose>(weights, perm);
+            auto scale = op::Constant::create(element::f32, Shape{1}, {0.5f});
+            auto multiply = make_shared<op::v1::Multiply>(transpose, scale);
+            multiply->set_friendly_name("weights_" + to_string(layer) + "_" + to_string(i));
+            outputs.push_back(multiply);
+        }
+    }
+    return make_shared<Function>(outputs, ParameterVector{});
+}
+
+TEST(constant_folding, independent_subgraphs)
+{
+    const size_t layers = 3, hidden = 160;
+    auto f = make_transposed_weights_function(layers, hidden);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), layers * 4);
+    for (size_t k = 0; k < layers * 4; k++)
+    {
+        auto new_const =
+            as_type_ptr<op::Constant>(f->get_results().at(k)->input_value(0).get_node_shared_ptr());
+        ASSERT_TRUE(new_const);
+        ASSERT_EQ(new_const->get_friendly_name(),
+                  "weights_" + to_string(k / 4) + "_" + to_string(k % 4));
+        const auto values_out = new_const->get_vector<float>();
+        for (size_t row = 0; row < hidden; row++)
+        {
+            for (size_t col = 0; col < hidden; col++)
+            {
+                ASSERT_EQ(0.5f * (k + col * hidden + row), values_out[row * hidden + col]);
+            }
+        }
+    }
+}
+
+TEST(constant_folding, subgraphs_of_different_depth)
+{
+    // the Add is ready for folding only after the deeper input is folded in the second wave
+    auto perm = op::Constant::create(element::i64, Shape{2}, {1, 0});
+    auto deep = make_shared<op::Transpose>(
+        make_shared<op::Transpose>(op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6}),
+                                   perm),
+        perm);
+    auto shallow = make_shared<op::Transpose>(
+        op::Constant::create(element::f32, Shape{3, 2}, {10, 40, 20, 50, 30, 60}), perm);
+    auto add = make_shared<op::v1::Add>(deep, shallow);
+    add->set_friendly_name("add");
+    auto f = make_shared<Function>(add, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_friendly_name(), "add");
+    ASSERT_EQ(new_const->get_vector<float>(), (vector<float>{11, 22, 33, 44, 55, 66}));
+}
+
+// It only reports the time, so it runs with --gtest_also_run_disabled_tests
+TEST(constant_folding, DISABLED_transposed_weights_load_time)
+{
+    const size_t layers = 12, hidden = 768;
+    auto f = make_transposed_weights_function(layers, hidden);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    const auto start = chrono::steady_clock::now();
+    pass_manager.run_passes(f);
+    const chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << "Folding of " << layers << " BERT-like layers: " << elapsed.count() << " ms" << endl;
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), layers * 4);
+}
+
 template <typename T>
 void range_test(T start, T stop, T step, const vector<T>& values_expected)
 {
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset5.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+namespace
+{
+    bool contains(const NodeVector& nodes, const shared_ptr<Node>& node)
+    {
+        return find(nodes.begin(), nodes.end(), node) != nodes.end();
+    }
+
+    // position of the node in the order or size of the order if there is no such node
+    size_t position(const NodeVector& nodes, const shared_ptr<Node>& node)
+    {
+        return distance(nodes.begin(), find(nodes.begin(), nodes.end(), node));
+    }
+
+    // makes the function count how many times its nodes are sorted
+    void count_sorts(const shared_ptr<Function>& f, size_t& count)
+    {
+        f->set_topological_sort([&count](const NodeVector& root_nodes) {
+            count++;
+            return topological_sort(root_nodes);
+        });
+    }
+}
+
+TEST(function, get_ordered_ops_unchanged_graph)
+{
+    auto f = make_test_graph();
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_TRUE(validate_list(ordered_ops));
+    EXPECT_EQ(ordered_ops, f->get_ordered_ops());
+}
+
+TEST(function, get_ordered_ops_after_replace_node)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto f = make_shared<Function>(abs, ParameterVector{arg});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), relu));
+
+    auto sigmoid = make_shared<opset5::Sigmoid>(arg);
+    replace_node(relu, sigmoid);
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_EQ(ordered_ops.size(), 4u);
+    EXPECT_FALSE(contains(ordered_ops, relu));
+    EXPECT_LT(position(ordered_ops, sigmoid), position(ordered_ops, abs));
+
+    // the order is not cached with the ownership of the nodes
+    weak_ptr<Node> removed = relu;
+    relu.reset();
+    ordered_ops.clear();
+    f->get_ordered_ops();
+    EXPECT_TRUE(removed.expired());
+}
+
+TEST(function, get_ordered_ops_after_input_change)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg);
+    auto abs = make_shared<opset5::Abs>(arg);
+    auto add = make_shared<opset5::Add>(relu, arg);
+    auto f = make_shared<Function>(add, ParameterVector{arg});
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+
+    add->input(1).replace_source_output(abs);
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_TRUE(contains(ordered_ops, abs));
+    EXPECT_LT(position(ordered_ops, abs), position(ordered_ops, add));
+}
+
+TEST(function, get_ordered_ops_after_control_dependency_change)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg);
+    auto abs = make_shared<opset5::Abs>(arg);
+    auto f = make_shared<Function>(relu, ParameterVector{arg});
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+
+    relu->add_control_dependency(abs);
+    auto ordered_ops = f->get_ordered_ops();
+    EXPECT_LT(position(ordered_ops, abs), position(ordered_ops, relu));
+
+    relu->remove_control_dependency(abs);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+}
+
+TEST(function, get_ordered_ops_after_results_change)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg);
+    auto abs = make_shared<opset5::Abs>(arg);
+    auto f = make_shared<Function>(relu, ParameterVector{arg});
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+
+    auto result = make_shared<opset5::Result>(abs);
+    f->add_results({result});
+    EXPECT_TRUE(contains(f->get_ordered_ops(), abs));
+
+    f->remove_result(result);
+    EXPECT_FALSE(contains(f->get_ordered_ops(), abs));
+}
+
+TEST(function, get_ordered_ops_is_not_invalidated_by_other_functions)
+{
+    auto arg1 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto f1 = make_shared<Function>(make_shared<opset5::Relu>(arg1), ParameterVector{arg1});
+    auto arg2 = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu2 = make_shared<opset5::Relu>(arg2);
+    auto f2 = make_shared<Function>(make_shared<opset5::Abs>(relu2), ParameterVector{arg2});
+    size_t f1_sorts = 0, f2_sorts = 0;
+    count_sorts(f1, f1_sorts);
+    count_sorts(f2, f2_sorts);
+    f1->get_ordered_ops();
+    f2->get_ordered_ops();
+    EXPECT_EQ(f1_sorts, 1u);
+    EXPECT_EQ(f2_sorts, 1u);
+
+    replace_node(relu2, make_shared<opset5::Sigmoid>(arg2));
+    f1->get_ordered_ops();
+    f2->get_ordered_ops();
+    EXPECT_EQ(f1_sorts, 1u);
+    EXPECT_EQ(f2_sorts, 2u);
+}
+
+TEST(function, get_ordered_ops_of_functions_sharing_nodes)
+{
+    auto arg = make_shared<opset5::Parameter>(element::f32, Shape{2, 2});
+    auto relu = make_shared<opset5::Relu>(arg);
+    auto abs = make_shared<opset5::Abs>(relu);
+    auto f1 = make_shared<Function>(abs, ParameterVector{arg});
+    auto f2 = make_shared<Function>(make_shared<opset5::Negative>(abs), ParameterVector{arg});
+    f1->get_ordered_ops();
+    f2->get_ordered_ops();
+
+    auto sigmoid = make_shared<opset5::Sigmoid>(arg);
+    replace_node(relu, sigmoid);
+    EXPECT_TRUE(contains(f1->get_ordered_ops(), sigmoid));
+    EXPECT_TRUE(contains(f2->get_ordered_ops(), sigmoid));
+}
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
 #include "ngraph/type/element_type.hpp"
@@ -101,6 +103,62 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+#ifndef _WIN32
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_tensors_share_mapping_within_import)
+{
+    const auto model_path = file_util::path_join(
+        SERIALIZED_ZOO,
+        "onnx/external_data/external_data_two_tensors_data_in_the_same_file.prototxt");
+    auto get_constants = [](const std::shared_ptr<Function>& function) {
+        std::vector<std::shared_ptr<default_opset::Constant>> constants;
+        for (const auto& op : function->get_ordered_ops())
+        {
+            if (const auto constant = as_type_ptr<default_opset::Constant>(op))
+            {
+                constants.push_back(constant);
+            }
+        }
+        std::sort(constants.begin(),
+                  constants.end(),
+                  [](const std::shared_ptr<default_opset::Constant>& lhs,
+                     const std::shared_ptr<default_opset::Constant>& rhs) {
+                      return lhs->get_data_ptr<char>() < rhs->get_data_ptr<char>();
+                  });
+        return constants;
+    };
+
+    const auto function = onnx_import::import_onnx_model(model_path);
+    const auto constants = get_constants(function);
+    // the tensors are views of one file mapping at their offsets: 0 and 4096
+    ASSERT_EQ(constants.size(), 2);
+    EXPECT_EQ(constants[1]->get_data_ptr<char>() - constants[0]->get_data_ptr<char>(), 4096);
+
+    // another import maps the file on its own, so changing the data of its Constants in place
+    // does not change the first model
+    const auto other_function = onnx_import::import_onnx_model(model_path);
+    const auto other_constants = get_constants(other_function);
+    ASSERT_EQ(other_constants.size(), 2);
+    EXPECT_NE(other_constants[0]->get_data_ptr<char>(), constants[0]->get_data_ptr<char>());
+    const auto original = constants[0]->get_vector<float>();
+    auto other_data = const_cast<float*>(other_constants[0]->get_data_ptr<float>());
+    std::fill_n(other_data, original.size(), 42.0f);
+    EXPECT_EQ(constants[0]->get_vector<float>(), original);
+}
+#endif
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_offset_not_multiple_of_page_size)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO, "onnx/external_data/external_data_unaligned_offset.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    // first input: {2, 3} read from the middle of a page of external file
+    test_case.add_input<int32_t>({5, 4});
+
+    test_case.add_expected_output<int32_t>({7, 7});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
@@ -301,3 +301,48 @@ TEST(op_eval, matmul_dynamic_broadcast_transpose1)
         ASSERT_EQ(read_vector<int64_t>(result), expected_result[i]);
     }
 }
+
+TEST(op_eval, matmul_large_matches_sequential_sums)
+{
+    // Large enough to be split between threads and into column blocks
+    const size_t batch = 3, m = 37, k = 70, n = 131;
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{batch, m, k});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{k, n});
+    auto matmul = make_shared<op::MatMul>(arg0, arg1, false, false);
+    auto fun = make_shared<Function>(OutputVector{matmul}, ParameterVector{arg0, arg1});
+
+    vector<float> arg0_input(batch * m * k);
+    vector<float> arg1_input(k * n);
+    for (size_t i = 0; i < arg0_input.size(); i++)
+    {
+        arg0_input[i] = static_cast<float>(i % 17) / 7.0f - 1.0f;
+    }
+    for (size_t i = 0; i < arg1_input.size(); i++)
+    {
+        arg1_input[i] = static_cast<float>(i % 13) / 3.0f - 2.0f;
+    }
+
+    // Every sum is accumulated in double in the order of the dotted axis
+    vector<float> expected_result(batch * m * n);
+    for (size_t row = 0; row < batch * m; row++)
+    {
+        for (size_t col = 0; col < n; col++)
+        {
+            double sum = 0;
+            for (size_t i = 0; i < k; i++)
+            {
+                sum = sum + static_cast<double>(arg0_input[row * k + i]) *
+                                static_cast<double>(arg1_input[i * n + col]);
+            }
+            expected_result[row * n + col] = static_cast<float>(sum);
+        }
+    }
+
+    auto result = make_shared<HostTensor>();
+    ASSERT_TRUE(
+        fun->evaluate({result},
+                      {make_host_tensor<element::Type_t::f32>(Shape{batch, m, k}, arg0_input),
+                       make_host_tensor<element::Type_t::f32>(Shape{k, n}, arg1_input)}));
+    EXPECT_EQ(result->get_shape(), (Shape{batch, m, n}));
+    ASSERT_EQ(read_vector<float>(result), expected_result);
+}
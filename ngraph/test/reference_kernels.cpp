@@ -0,0 +1,476 @@
+//*****************************************************************************
+// Copyright 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/mean.hpp"
+#include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/shape_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The reference kernels walk their data with precomputed strides and split the output between
+// threads. These tests compare them bit by bit with straightforward loops which visit the
+// elements in the order of the CoordinateTransform based kernels.
+
+namespace
+{
+    vector<float> random_values(size_t count, float min, float max)
+    {
+        mt19937 generator(17);
+        uniform_real_distribution<float> distribution(min, max);
+        vector<float> values(count);
+        for (auto& value : values)
+        {
+            value = distribution(generator);
+        }
+        return values;
+    }
+
+    // Returns the position of the padded and dilated coordinate in the data, or -1 if it falls
+    // into the padding or a dilation gap
+    ptrdiff_t data_position(ptrdiff_t padded, size_t size, ptrdiff_t dilation)
+    {
+        if (padded < 0 || padded > static_cast<ptrdiff_t>(size - 1) * dilation ||
+            padded % dilation != 0)
+        {
+            return -1;
+        }
+        return padded / dilation;
+    }
+
+    void naive_convolution_2d(const float* in,
+                              const float* filter,
+                              float* out,
+                              const Shape& in_shape,
+                              const Shape& filter_shape,
+                              const Shape& out_shape,
+                              const Strides& stride,
+                              const Strides& filter_dilation,
+                              const CoordinateDiff& pad_below,
+                              const Strides& in_dilation)
+    {
+        for (size_t n = 0; n < out_shape[0]; n++)
+            for (size_t oc = 0; oc < out_shape[1]; oc++)
+                for (size_t oy = 0; oy < out_shape[2]; oy++)
+                    for (size_t ox = 0; ox < out_shape[3]; ox++)
+                    {
+                        double result = 0;
+                        for (size_t ky = 0; ky < filter_shape[2]; ky++)
+                            for (size_t kx = 0; kx < filter_shape[3]; kx++)
+                            {
+                                const ptrdiff_t y = data_position(
+                                    static_cast<ptrdiff_t>(oy * stride[0] +
+                                                           ky * filter_dilation[0]) -
+                                        pad_below[0],
+                                    in_shape[2],
+                                    in_dilation[0]);
+                                const ptrdiff_t x = data_position(
+                                    static_cast<ptrdiff_t>(ox * stride[1] +
+                                                           kx * filter_dilation[1]) -
+                                        pad_below[1],
+                                    in_shape[3],
+                                    in_dilation[1]);
+                                if (y < 0 || x < 0)
+                                {
+                                    continue;
+                                }
+                                for (size_t ic = 0; ic < in_shape[1]; ic++)
+                                {
+                                    const size_t in_index =
+                                        ((n * in_shape[1] + ic) * in_shape[2] + y) * in_shape[3] +
+                                        x;
+                                    const size_t filter_index =
+                                        ((oc * filter_shape[1] + ic) * filter_shape[2] + ky) *
+                                            filter_shape[3] +
+                                        kx;
+                                    result += static_cast<double>(in[in_index]) *
+                                              static_cast<double>(filter[filter_index]);
+                                }
+                            }
+                        out[((n * out_shape[1] + oc) * out_shape[2] + oy) * out_shape[3] + ox] =
+                            static_cast<float>(result);
+                    }
+    }
+
+    // Calls start(out_index) for every 2D pooling window, accumulate(out_index, in_index) for its
+    // in-bounds elements and finish(out_index, count) with the number of these elements
+    void naive_pool_2d(const Shape& in_shape,
+                       const Shape& out_shape,
+                       const Shape& window_shape,
+                       const Strides& strides,
+                       const Shape& pad_below,
+                       const function<void(size_t)>& start,
+                       const function<void(size_t, size_t)>& accumulate,
+                       const function<void(size_t, size_t)>& finish)
+    {
+        for (size_t nc = 0; nc < out_shape[0] * out_shape[1]; nc++)
+            for (size_t oy = 0; oy < out_shape[2]; oy++)
+                for (size_t ox = 0; ox < out_shape[3]; ox++)
+                {
+                    const size_t out_index = (nc * out_shape[2] + oy) * out_shape[3] + ox;
+                    size_t count = 0;
+                    start(out_index);
+                    for (size_t wy = 0; wy < window_shape[0]; wy++)
+                        for (size_t wx = 0; wx < window_shape[1]; wx++)
+                        {
+                            const ptrdiff_t y = data_position(
+                                static_cast<ptrdiff_t>(oy * strides[0] + wy - pad_below[0]),
+                                in_shape[2],
+                                1);
+                            const ptrdiff_t x = data_position(
+                                static_cast<ptrdiff_t>(ox * strides[1] + wx - pad_below[1]),
+                                in_shape[3],
+                                1);
+                            if (y >= 0 && x >= 0)
+                            {
+                                accumulate(out_index, (nc * in_shape[2] + y) * in_shape[3] + x);
+                                count++;
+                            }
+                        }
+                    finish(out_index, count);
+                }
+    }
+
+    // Reduces the input in the row-major order of its elements
+    void naive_reduce(const Shape& in_shape,
+                      const AxisSet& axes,
+                      const function<void(size_t in_index, size_t out_index)>& func)
+    {
+        const Shape out_shape = reduce(in_shape, axes, false);
+        CoordinateTransform in_transform(in_shape);
+        CoordinateTransform out_transform(out_shape);
+        for (const Coordinate& in_coord : in_transform)
+        {
+            func(in_transform.index(in_coord),
+                 out_transform.index(reduce(in_coord, axes, false)));
+        }
+    }
+
+    void expect_bitwise_eq(const vector<float>& expected, const vector<float>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            ASSERT_EQ(expected[i], actual[i]) << "index: " << i;
+        }
+    }
+}
+
+TEST(reference_kernels, convolution_padding_and_dilation)
+{
+    const Shape in_shape{2, 3, 23, 29};
+    const Shape filter_shape{4, 3, 3, 3};
+    const Strides stride{2, 1};
+    const Strides filter_dilation{2, 3};
+    const CoordinateDiff pad_below{2, 1};
+    const CoordinateDiff pad_above{1, 3};
+    const Strides in_dilation{1, 2};
+    Shape out_shape{in_shape[0], filter_shape[0], 0, 0};
+    for (size_t i = 0; i < 2; i++)
+    {
+        const size_t padded =
+            (in_shape[i + 2] - 1) * in_dilation[i] + 1 + pad_below[i] + pad_above[i];
+        const size_t window = (filter_shape[i + 2] - 1) * filter_dilation[i] + 1;
+        out_shape[i + 2] = (padded - window) / stride[i] + 1;
+    }
+
+    const auto in = random_values(shape_size(in_shape), -1.0f, 1.0f);
+    const auto filter = random_values(shape_size(filter_shape), -1.0f, 1.0f);
+    vector<float> expected(shape_size(out_shape));
+    naive_convolution_2d(in.data(),
+                         filter.data(),
+                         expected.data(),
+                         in_shape,
+                         filter_shape,
+                         out_shape,
+                         stride,
+                         filter_dilation,
+                         pad_below,
+                         in_dilation);
+
+    // The result does not depend on the number of threads
+    for (size_t threads : {1, 4})
+    {
+        runtime::ParallelThreadsLimit threads_limit(threads);
+        vector<float> actual(shape_size(out_shape));
+        runtime::reference::convolution(in.data(),
+                                        filter.data(),
+                                        actual.data(),
+                                        in_shape,
+                                        filter_shape,
+                                        out_shape,
+                                        stride,
+                                        filter_dilation,
+                                        pad_below,
+                                        pad_above,
+                                        in_dilation);
+        expect_bitwise_eq(expected, actual);
+    }
+}
+
+TEST(reference_kernels, max_pool_padding)
+{
+    const Shape in_shape{2, 8, 33, 37};
+    const Shape window_shape{3, 4};
+    const Strides strides{2, 3};
+    const Shape pad_below{1, 2};
+    const Shape pad_above{2, 1};
+    const Shape out_shape{2, 8, 17, 13};
+
+    const auto in = random_values(shape_size(in_shape), -1.0f, 1.0f);
+    vector<float> expected(shape_size(out_shape));
+    naive_pool_2d(in_shape,
+                  out_shape,
+                  window_shape,
+                  strides,
+                  pad_below,
+                  [&](size_t out_index) {
+                      expected[out_index] = numeric_limits<float>::lowest();
+                  },
+                  [&](size_t out_index, size_t in_index) {
+                      expected[out_index] =
+                          in[in_index] > expected[out_index] ? in[in_index] : expected[out_index];
+                  },
+                  [](size_t, size_t) {});
+
+    for (size_t threads : {1, 4})
+    {
+        runtime::ParallelThreadsLimit threads_limit(threads);
+        vector<float> actual(shape_size(out_shape));
+        runtime::reference::max_pool(in.data(),
+                                     actual.data(),
+                                     in_shape,
+                                     out_shape,
+                                     window_shape,
+                                     strides,
+                                     pad_below,
+                                     pad_above);
+        expect_bitwise_eq(expected, actual);
+    }
+}
+
+TEST(reference_kernels, avg_pool_include_and_exclude_padding)
+{
+    const Shape in_shape{2, 8, 33, 37};
+    const Shape window_shape{3, 4};
+    const Strides strides{2, 3};
+    const Shape pad_below{1, 2};
+    const Shape pad_above{2, 1};
+    const Shape out_shape{2, 8, 17, 13};
+
+    const auto in = random_values(shape_size(in_shape), -1.0f, 1.0f);
+    for (bool include_padding : {false, true})
+    {
+        vector<float> expected(shape_size(out_shape));
+        naive_pool_2d(in_shape,
+                      out_shape,
+                      window_shape,
+                      strides,
+                      pad_below,
+                      [&](size_t out_index) { expected[out_index] = 0; },
+                      [&](size_t out_index, size_t in_index) {
+                          expected[out_index] += in[in_index];
+                      },
+                      [&](size_t out_index, size_t count) {
+                          if (include_padding)
+                          {
+                              count = shape_size(window_shape);
+                          }
+                          expected[out_index] = expected[out_index] / count;
+                      });
+
+        for (size_t threads : {1, 4})
+        {
+            runtime::ParallelThreadsLimit threads_limit(threads);
+            vector<float> actual(shape_size(out_shape));
+            runtime::reference::avg_pool(in.data(),
+                                         actual.data(),
+                                         in_shape,
+                                         out_shape,
+                                         window_shape,
+                                         strides,
+                                         pad_below,
+                                         pad_above,
+                                         include_padding);
+            expect_bitwise_eq(expected, actual);
+        }
+    }
+}
+
+TEST(reference_kernels, reductions)
+{
+    const Shape in_shape{3, 4, 5, 6};
+    const auto in = random_values(shape_size(in_shape), 0.5f, 1.5f);
+    for (const AxisSet& axes : {AxisSet{}, AxisSet{0}, AxisSet{3}, AxisSet{1, 3}, AxisSet{0, 2, 3}})
+    {
+        const size_t out_size = shape_size(reduce(in_shape, axes, false));
+
+        // Sum and mean use the Kahan summation
+        vector<float> expected_sum(out_size, 0), compensation(out_size, 0);
+        vector<float> expected_max(out_size, -numeric_limits<float>::infinity());
+        vector<float> expected_min(out_size, numeric_limits<float>::infinity());
+        vector<float> expected_product(out_size, 1);
+        naive_reduce(in_shape, axes, [&](size_t in_index, size_t out_index) {
+            const float x = in[in_index];
+            float& z = expected_sum[out_index];
+            float& c = compensation[out_index];
+            const float t = z + (x - c);
+            c = (t - z) - (x - c);
+            z = t;
+            expected_max[out_index] = x > expected_max[out_index] ? x : expected_max[out_index];
+            expected_min[out_index] = x < expected_min[out_index] ? x : expected_min[out_index];
+            expected_product[out_index] = expected_product[out_index] * x;
+        });
+        vector<float> expected_mean(out_size);
+        for (size_t i = 0; i < out_size; i++)
+        {
+            expected_mean[i] =
+                expected_sum[i] / static_cast<int>(shape_size(in_shape) / out_size);
+        }
+
+        for (bool keep_dims : {false, true})
+        {
+            vector<float> actual(out_size);
+            runtime::reference::sum(in.data(), actual.data(), in_shape, axes, keep_dims);
+            expect_bitwise_eq(expected_sum, actual);
+            runtime::reference::mean(in.data(), actual.data(), in_shape, axes, keep_dims);
+            expect_bitwise_eq(expected_mean, actual);
+            runtime::reference::max(in.data(), actual.data(), in_shape, axes, keep_dims);
+            expect_bitwise_eq(expected_max, actual);
+            runtime::reference::min(in.data(), actual.data(), in_shape, axes, keep_dims);
+            expect_bitwise_eq(expected_min, actual);
+            runtime::reference::product(in.data(), actual.data(), in_shape, axes, keep_dims);
+            expect_bitwise_eq(expected_product, actual);
+        }
+    }
+}
+
+TEST(reference_kernels, select_numpy_broadcast)
+{
+    const Shape out_shape{2, 3, 4, 5};
+    for (const auto& shapes : vector<vector<Shape>>{{{2, 1, 4, 1}, {3, 1, 5}, {1, 3, 4, 1}},
+                                                    {{5}, {2, 3, 4, 5}, {}},
+                                                    {{1, 3, 1, 1}, {4, 1}, {2, 1, 1, 5}}})
+    {
+        const Shape& cond_shape = shapes[0];
+        const Shape& then_shape = shapes[1];
+        const Shape& else_shape = shapes[2];
+        vector<char> cond(shape_size(cond_shape));
+        for (size_t i = 0; i < cond.size(); i++)
+        {
+            cond[i] = i % 3 == 0;
+        }
+        const auto then_values = random_values(shape_size(then_shape), -1.0f, 0.0f);
+        const auto else_values = random_values(shape_size(else_shape), 0.0f, 1.0f);
+
+        // Broadcasted inputs are aligned to the right, their dimensions of 1 are repeated
+        auto broadcast_index = [&](const Coordinate& out_coord, const Shape& shape) {
+            const size_t offset = out_shape.size() - shape.size();
+            size_t index = 0;
+            for (size_t i = 0; i < shape.size(); i++)
+            {
+                index = index * shape[i] + (shape[i] == 1 ? 0 : out_coord[offset + i]);
+            }
+            return index;
+        };
+        vector<float> expected(shape_size(out_shape));
+        CoordinateTransform out_transform(out_shape);
+        for (const Coordinate& out_coord : out_transform)
+        {
+            expected[out_transform.index(out_coord)] =
+                cond[broadcast_index(out_coord, cond_shape)]
+                    ? then_values[broadcast_index(out_coord, then_shape)]
+                    : else_values[broadcast_index(out_coord, else_shape)];
+        }
+
+        vector<float> actual(shape_size(out_shape));
+        runtime::reference::select(cond.data(),
+                                   then_values.data(),
+                                   else_values.data(),
+                                   actual.data(),
+                                   cond_shape,
+                                   then_shape,
+                                   else_shape,
+                                   op::AutoBroadcastSpec(op::AutoBroadcastType::NUMPY));
+        expect_bitwise_eq(expected, actual);
+    }
+}
+
+TEST(reference_kernels, parallel_for_from_several_threads)
+{
+    // Callers share the worker threads, every item is processed exactly once by every call
+    runtime::ParallelThreadsLimit threads_limit(4);
+    vector<thread> callers;
+    vector<vector<int>> counts(4, vector<int>(1000));
+    for (auto& caller_counts : counts)
+    {
+        callers.emplace_back([&caller_counts] {
+            runtime::ParallelThreadsLimit caller_threads_limit(4);
+            for (size_t call = 0; call < 100; call++)
+            {
+                runtime::parallel_for(caller_counts.size(), 1, [&](size_t begin, size_t end) {
+                    // nested calls run in the thread of the chunk
+                    runtime::parallel_for(
+                        end - begin, 1, [&](size_t nested_begin, size_t nested_end) {
+                            for (size_t i = begin + nested_begin; i < begin + nested_end; i++)
+                            {
+                                caller_counts[i]++;
+                            }
+                        });
+                });
+            }
+        });
+    }
+    for (auto& caller : callers)
+    {
+        caller.join();
+    }
+    for (const auto& caller_counts : counts)
+    {
+        for (size_t i = 0; i < caller_counts.size(); i++)
+        {
+            ASSERT_EQ(100, caller_counts[i]) << "index: " << i;
+        }
+    }
+
+    EXPECT_THROW(runtime::parallel_for(1000,
+                                       1,
+                                       [](size_t begin, size_t) {
+                                           if (begin != 0)
+                                           {
+                                               throw runtime_error("chunk failed");
+                                           }
+                                       }),
+                 runtime_error);
+}